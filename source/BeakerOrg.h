@@ -3,9 +3,15 @@
 #ifndef BEAKER_ORG_H
 #define BEAKER_ORG_H
 
+#include "base/vector.h"
+#include "base/Ptr.h"
 #include "geometry/Point2D.h"
 #include "hardware/EventDrivenGP.h"
 
+#include "BrainPool.h"
+
+#include <utility>
+
 class BeakerOrg {
 public:
   static constexpr size_t TAG_WIDTH = 16;
@@ -19,48 +25,86 @@ public:
   using inst_t = hardware_t::inst_t;
   using inst_lib_t = hardware_t::inst_lib_t;
   using hw_state_t = hardware_t::State;
+  using pool_t = BrainPool<hardware_t>;
 
   enum class Trait {HEAT_ID, MAP_ID, WRL_ID};
 
+  ///< World-affecting action recorded while the brain runs and applied by the world afterwards.
+  struct Intent
+  {
+    enum class Type {MOVE, CONSUME};
+    Type type;
+    emp::Point shift;                 ///< How far to move (MOVE only)
+  };
+
 public:
   size_t id;                        ///< Organism personal ID
   size_t surface_id;                ///< Organism surface ID
   size_t map_id;                    ///< Oraganism map id
   size_t wrl_id;                    ///< Organism world id
-  double radius;                     ///< Organism radius
+  size_t genome_id = (size_t) -1;   ///< Shared genome this program matches (see GenomeTable)
+  size_t taxon_id = (size_t) -1;    ///< Taxon in the world's phylogeny
 
-  hardware_t brain;                 ///< Underlying represet
-  emp::Angle facing;                ///< Direction the organism if facing!
-  double energy;                    ///< Amount of energy the organims has
-  size_t heat_id;                      ///< Stores heat_id of the organism
+  emp::Ptr<pool_t> pool;            ///< Where our brain comes from and goes back to
+  emp::Ptr<hardware_t> brain;       ///< Underlying represet (recycled from the pool)
+  emp::vector<Intent> intents;      ///< Actions waiting to be applied to the world
 
-public:
-  BeakerOrg(inst_lib_t & inst_lib, event_lib_t & event_lib, emp::Ptr<emp::Random> random_ptr)
-    : id(0), brain(inst_lib, event_lib, random_ptr), facing(), energy(1000.0)
+  void ConfigBrain()
   {
-    brain.SetMinBindThresh(HW_MIN_SIM_THRESH);
-    brain.SetMaxCores(HW_MAX_THREADS);
-    brain.SetMaxCallDepth(HW_MAX_CALL_DEPTH);  
+    brain->SetMinBindThresh(HW_MIN_SIM_THRESH);
+    brain->SetMaxCores(HW_MAX_THREADS);
+    brain->SetMaxCallDepth(HW_MAX_CALL_DEPTH);  
   }
-  BeakerOrg(const BeakerOrg &) = default;
-
 
-  BeakerOrg(BeakerOrg &&) = default;
-  ~BeakerOrg() { ; }
+public:
+  BeakerOrg(emp::Ptr<pool_t> _pool)
+    : id(0), surface_id((size_t) -1), pool(_pool), brain(_pool->Acquire())
+  {
+    ConfigBrain();
+  }
+  ///< Copies only ids and the program into a recycled brain; hardware state starts clean.
+  BeakerOrg(const BeakerOrg & in)
+    : id(in.id), surface_id(in.surface_id), map_id(in.map_id), wrl_id(in.wrl_id), genome_id(in.genome_id), taxon_id(in.taxon_id),
+      pool(in.pool), brain(in.pool->Acquire())
+  {
+    ConfigBrain();
+    brain->SetProgram(in.brain->GetProgram());
+  }
+  BeakerOrg(BeakerOrg && in)
+    : id(in.id), surface_id(in.surface_id), map_id(in.map_id), wrl_id(in.wrl_id), genome_id(in.genome_id), taxon_id(in.taxon_id),
+      pool(in.pool), brain(in.brain), intents(std::move(in.intents))
+  {
+    in.brain = nullptr;
+  }
+  ~BeakerOrg() { if(brain) { pool->Release(brain); } }
 
-  BeakerOrg & operator=(const BeakerOrg &) = default;
-  BeakerOrg & operator=(BeakerOrg &&) = default;
+  BeakerOrg & operator=(const BeakerOrg & in)
+  {
+    if(this == &in) { return *this; }
+    id = in.id; surface_id = in.surface_id; map_id = in.map_id; wrl_id = in.wrl_id; genome_id = in.genome_id; taxon_id = in.taxon_id;
+    brain->ResetHardware();
+    brain->SetProgram(in.brain->GetProgram());
+    intents.clear();
+    return *this;
+  }
+  BeakerOrg & operator=(BeakerOrg && in)
+  {
+    id = in.id; surface_id = in.surface_id; map_id = in.map_id; wrl_id = in.wrl_id; genome_id = in.genome_id; taxon_id = in.taxon_id;
+    std::swap(pool, in.pool);
+    std::swap(brain, in.brain);
+    std::swap(intents, in.intents);
+    return *this;
+  }
 
   size_t GetID() const { return id; }
   size_t GetSurfaceID() { return surface_id; }
   size_t GetWorldID() { return wrl_id; }
-  size_t GetRadius() { return radius; }
   size_t GetMapID() {return map_id;}
-  hardware_t & GetBrain() { return brain; }
-  const hardware_t & GetBrain() const { return brain; }
-  emp::Angle GetFacing() const { return facing; }
-  double GetEnergy() const { return energy; }
-  size_t GetHeatID() const { return heat_id; }
+  size_t GetGenomeID() const { return genome_id; }
+  size_t GetTaxonID() const { return taxon_id; }
+  hardware_t & GetBrain() { return *brain; }
+  const hardware_t & GetBrain() const { return *brain; }
+  const emp::vector<Intent> & GetIntents() const { return intents; }
 
 
   ///< Set the ID of the organism!
@@ -69,58 +113,42 @@ public:
   BeakerOrg & SetSurfaceID(size_t _in) { surface_id = _in; return *this; }
   ///< Set the World ID 
   BeakerOrg & SetWorldID(size_t _in) { wrl_id = _in; return *this; }
-  ///< Set the radius
-  BeakerOrg & SetRadius(double _in) { radius = _in; return *this;}
   ///< Set the Map ID 
   BeakerOrg & SetMapID(size_t _in) { map_id = _in; return *this; }
-  ///< Set the World ID 
-  BeakerOrg & SetHeatID(size_t _in) { heat_id = _in; return *this; }
-  ///< Set the direction the organims is facing!
-  BeakerOrg & SetFacing(emp::Angle _in) { facing = _in; return *this; }
-  ///< Set the energy variable!
-  BeakerOrg & SetEnergy(double _in) { energy = _in; return *this; }
+  ///< Set the Genome ID 
+  BeakerOrg & SetGenomeID(size_t _in) { genome_id = _in; return *this; }
+  ///< Set the Taxon ID 
+  BeakerOrg & SetTaxonID(size_t _in) { taxon_id = _in; return *this; }
 
 
-
-  ///< Subtract Energy to the organism and return this organism!
-  BeakerOrg & SubEnergy(double _in) { energy -= _in; return *this;}
-  ///< Rotate the direction that organism is facing!
-  BeakerOrg & RotateDegrees(double degrees) { facing.RotateDegrees(degrees); return *this; }
-  ///< Add Energy to the organism and return this organism!
-  BeakerOrg & AddEnergy(double _in, double cap) 
-  {
-    (energy + _in > cap) ? energy = cap : energy += _in;
-    return *this;
-  }
-
-  void Setup(emp::WorldPosition pos, emp::Random & random) 
-  {
-    RotateDegrees(random.GetDouble(360.0));     
-  }
+  ///< Record an action for the world to apply after all brains have run!
+  BeakerOrg & PushIntent(Intent::Type type, emp::Point shift=emp::Point()) { intents.push_back({type, shift}); return *this; }
+  ///< Forget all recorded actions (keeps the buffer around)!
+  BeakerOrg & ClearIntents() { intents.clear(); return *this; }
 
   void Process(size_t exe_count) 
   {
-    brain.Process(exe_count);
+    brain->Process(exe_count);
   };
 
   double GetTrait(size_t pos)
   {
-    return brain.GetTrait(pos);
+    return brain->GetTrait(pos);
   }
 
   void SetTrait(size_t id, double val)
   {
-    brain.SetTrait(id, val);
+    brain->SetTrait(id, val);
   }
 
   void Load(std::istream & input)
   {
-    brain.Load(input);
+    brain->Load(input);
   }
 
   void PushInst(const std::string & name)
   {
-    brain.PushInst(name);
+    brain->PushInst(name);
   }
 };
 
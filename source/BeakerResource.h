@@ -8,14 +8,13 @@ struct BeakerResource
   private:
     size_t surface_id;        ///< Which surface object represents this resource?
     size_t map_id;            ///< Where is the resource in the resource vector?
-    size_t exp;               ///< Counts the number of updates the resources has persisted
-    // size_t exp_max;           ///< The maxiumum number of updates a resouce can persist
+    size_t due;               ///< Update the resource next expires or respawns ((size_t) -1 for never)
     bool init;                ///< Has this resource been initialized
 
   public:
     /* Constructor & Identifiers */
 
-    BeakerResource() : exp(0), init(false) {;}
+    BeakerResource() : due((size_t) -1), init(false) {;}
 
 
     /* Setters */
@@ -23,22 +22,17 @@ struct BeakerResource
     void SetSurfaceID(const size_t _in) {surface_id = _in;}     ///< Set SurfaceID
     void SetMapID(const size_t _in) {map_id = _in;}             ///< Set MapID
     void SetInit(const bool b) {init = b;}                      ///< Set Initialzied to true for debugging!
+    void SetDue(const size_t _in) {due = _in;}                  ///< Set when the resource next changes (see ResourceManager)
 
 
     /* Getters */
     
     const size_t GetSurfaceID() const {return surface_id;}      
     const size_t GetMapID() const {return map_id;}
-    const size_t GetExp() const {return exp;}
+    const size_t GetDue() const {return due;}
     const bool GetInit() const {return init;}
 
 
-    /* Expired Fucntions */
-
-    const bool Expired(size_t max) const {return exp == max;}
-    void IncExp() {exp++;}
-
-
     /* Debugging Functions */
 
     void PrintStats();
@@ -4,7 +4,6 @@
 
 ///< Includes from Empirical
 #include "Evolve/World.h"
-#include "geometry/Surface.h"
 #include "hardware/signalgp_utils.h"
 #include "tools/math.h"
 #include "base/assert.h"
@@ -14,14 +13,29 @@
 #include "BeakerResource.h"
 #include "BeakerOrg.h"
 #include "ResourceManager.h"
+#include "ResourceField.h"
+#include "SpatialGrid.h"
+#include "OrgTable.h"
+#include "WorkerPool.h"
+#include "RingBuffer.h"
+#include "Checkpoint.h"
+#include "StatsRecorder.h"
+#include "WorldStats.h"
+#include "CounterRandom.h"
+#include "StaticDispatch.h"
+#include "PackedGenome.h"
+#include "GenomeTable.h"
+#include "Phylogeny.h"
 
 ///< Standard C++ includes
-#include <queue>
-#include <set>
 #include <utility>
 #include <sstream>
 #include <unistd.h>
 #include <iomanip>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <fstream>
 
 class BeakerWorld : public emp::World<BeakerOrg> 
 {
@@ -38,20 +52,25 @@ class BeakerWorld : public emp::World<BeakerOrg>
     using inst_t = hardware_t::inst_t;
     using inst_lib_t = hardware_t::inst_lib_t;
     using hw_state_t = hardware_t::State;
-    using surface_t = emp::Surface<BeakerOrg, BeakerResource>;
     using mutator_t = emp::SignalGPMutator<TAG_WIDTH>;
     using memory_t = hardware_t::memory_t;
 
     // type for event pairing
     using event_t = std::pair<size_t, size_t>;
+    using hw_event_t = hardware_t::event_t;
+
+    static constexpr double RES_RADIUS = 3.0;                 ///< Radius of every resource body
+
+    ///< Independent random streams; each draw is keyed by (SEED, update, id, stream) so no stage shares a generator.
+    enum class Stream : uint32_t {SCHEDULE, BRAIN, MUTATE, RADIUS, FACING, RES_PLACE, ORG_PLACE, RESPAWN, PATCH};
 
 
     /* Configuration specific variables */
 
     BeakerConfig & config;                                    ///< Stores all experiment configurations
-    std::unordered_map<size_t, emp::Ptr<BeakerOrg>> id_map;   ///< Stores all surface and org world ids
     ResourceManager r_manager;                                  ///< Manages all surface resources
-    int next_id;                                              ///< Stores the id placement for id_map
+    int next_id;                                              ///< Stores the next unique org id (map id)
+    emp::vector<size_t> free_wids;                            ///< World ids of dead orgs, reused by births and injections (last freed first)
     size_t hm_size;                                           ///< Stores the size of the heat map
     emp::vector<size_t> scheduler;                            ///< Stores the order organisms are able to go
 
@@ -60,68 +79,151 @@ class BeakerWorld : public emp::World<BeakerOrg>
 
     inst_lib_t inst_lib;          ///< Variable that holds instruction library
     event_lib_t event_lib;        ///< Variable that holds event library
+    BeakerOrg::pool_t brain_pool; ///< Variable that recycles the brains of dead organisms
     mutator_t signalgp_mutator;   ///< Variable mutates organism genoms
+    WorkerPool worker_pool;       ///< Variable that runs brains in parallel
 
 
     /* Web Interface variables */
 
-    surface_t surface;                    ///< Variable that holds the surface organisms are on
+    SpatialGrid grid;                     ///< Variable that holds the surface bodies and indexes them for overlap queries
+    OrgTable orgs;                        ///< Variable that holds organism physics (position, radius, facing, energy, heat)
+    ResourceField field;                  ///< Variable that holds food as concentrations (RESOURCE_MODE 1)
     bool redraw = true;                   ///< Variable to tell if charts need to be redraw
 
 
     /* Statistics variables */
     
-    int death_stv = 0;       ///< Variables that holds number of deaths
-    int death_eat = 0;
-    int death_pop = 0;
-
-    int blue_cnt = 0;        ///< Variables that holds number of colors
-    int cyan_cnt = 0;
-    int lime_cnt = 0;
-    int yellow_cnt = 0;
-    int red_cnt = 0;
-    int white_cnt = 0;
+    WorldStats stats;         ///< Variable that holds population counts, moments and intake, kept up to date per event
 
-    double avg_blue = 0.0;    ///< Variables that store average radius of each color
-    double avg_cyan = 0.0;
-    double avg_lime = 0.0;
-    double avg_yellow = 0.0;
-    double avg_red = 0.0;
-    double avg_white = 0.0;
+    emp::Ptr<StatsRecorder> stats_rec = nullptr;    ///< Streams stats rows to disk (if STATS_FILE is set)
+    std::ofstream phylo_file;                       ///< Phylogeny snapshots (if PHYLO_FILE is set)
+    WorldStats::Snapshot stats_snap;                ///< Snapshot reused by RecordStats
+    emp::vector<double> stats_row;                  ///< Row reused by RecordStats
 
 
     /* World Event Tracker/Queue */
 
-    std::set<size_t> kill_list;                     ///< Holds org ids that have been eaten. <org_wid>
-    std::set<size_t> birth_list;                    ///< Holds org ids that can give birth. <org_wid>
-    std::set<size_t> eater_list;                    ///< Holds org ids that have eaten a resource <org_wid>
-    std::map<size_t, size_t> eaten_list;            ///< Variable that holds resources that have been eaten along with organims world-id. <res_id, org_wid>
-    std::queue<event_t> events;                     ///< Queue to hold all events that happen in the world. <(size_t) trait, wid/mid>
+    /// Lists are dense arrays holding the stamp of the update an id was listed in, so an id is
+    /// only on a list if its entry equals cur_stamp.  Nothing needs to be cleared between updates.
+
+    size_t cur_stamp = 1;                           ///< Stamp of the current update (update + 1, 0 means never)
+    emp::vector<size_t> kill_list;                  ///< Holds org ids that have been eaten. <org_wid>
+    emp::vector<size_t> birth_list;                 ///< Holds org ids that can give birth. <org_wid>
+    emp::vector<size_t> eater_list;                 ///< Holds org ids that have eaten a resource <org_wid>
+    emp::vector<size_t> eaten_list;                 ///< Holds resources that have been eaten. <res_id>
+    emp::vector<size_t> eaten_by;                   ///< Holds organims world-id that ate a resource. <res_id>
+    emp::vector<uint64_t> birth_mask;               ///< Bit per world id: org can give birth this update
+    emp::vector<uint64_t> starve_mask;              ///< Bit per world id: org starved this update
+    emp::vector<size_t> res_expired;                ///< Resources that expired this update <res_id>
+    emp::vector<size_t> res_respawn;                ///< Resources to put back on the surface this update <res_id>
+    emp::vector<emp::Point> res_points;             ///< Where each of res_respawn goes
+
+    /* Sensing Variables */
+
+    struct Percept                                  ///< What an org senses, worked out on its first sense of an update
+    {
+      size_t stamp = 0;                             ///< cur_stamp it was worked out in
+      double res_dist, res_bearing;                 ///< Nearest resource (distance -1 if none in range)
+      double larger_dist, larger_bearing;           ///< Nearest larger org
+      double smaller_dist, smaller_bearing;         ///< Nearest smaller org
+      double density;                               ///< Other orgs in range
+    };
+    emp::vector<Percept> percepts;                  ///< Percepts by world id (only the org's own thread touches its entry)
+
+    /* Signal Variables */
+
+    /// The world raises signals as bits (a pending bit per signal, plus a latch for the signals that
+    /// fire once per crossing) and hands them to the brains at the start of the next update by running
+    /// each prebuilt event's handler directly, so nothing goes through SignalGP's event queue.
+    ///< COLLIDED: its body overlaps another org after it moved.  ENERGY_LOW: energy fell below
+    ///< SIGNAL_ENERGY_LOW.  RES_NEAR: food came within SIGNAL_RES_RANGE.  ATTACKED: a strictly larger
+    ///< org bit it and it survived (it was below that org's bite window); bites by smaller orgs are ignored.
+    enum class Signal : uint8_t {COLLIDED, ENERGY_LOW, RES_NEAR, ATTACKED, NUM};
+    static constexpr size_t NUM_SIGNALS = (size_t) Signal::NUM;
+    emp::vector<uint8_t> signals;                   ///< Pending and latch bits by world id
+    emp::vector<hw_event_t> signal_events;          ///< Event delivered for each signal
+
+    RingBuffer<event_t> events;                     ///< Queue to hold all events that happen in the world. <(size_t) trait, wid/mid>
     enum class Trait {CONSUME, KILLED, BIRTH};      ///< Different kind of events
 
+    /* Birth Variables */
+
+    struct BirthState                               ///< Physical state of an offspring waiting to be placed
+    {
+      emp::Point center;
+      double radius;
+      emp::Angle facing;
+      size_t heat;
+    };
+    BirthState birth;                               ///< Filled before PlaceOffspring, used there and in OnPlacement
+    bool birth_ready = false;                       ///< Is there an offspring waiting for placement?
+
+    struct PendingBirth                             ///< Offspring recorded at its birth event, mutated and placed after the queue
+    {
+      size_t parent;                                ///< World id of the parent
+      size_t id;                                    ///< Map id the offspring will be placed with
+      BirthState state;
+      size_t genome_id;                             ///< Parent's genome (referenced until placement)
+      size_t taxon_id;                              ///< Parent's taxon (referenced until placement)
+      PackedGenome genome;                          ///< Offspring's genome, encoded only if mutations changed it
+      bool mutated = false;
+    };
+    emp::vector<PendingBirth> pending;              ///< Births of the current update, in event order
+    emp::vector<program_t> scratch;                 ///< One program per thread to unpack and mutate births in
+
     /* Debugging Variables */
 
     bool pred_inject = false;                       ///< Has the predetor organims been injected?
 
+    /* Genome Variables */
+
+    PackedGenome start_genome;                      ///< Program the initial population starts with
+    PackedGenome apex_genome;                       ///< Program injected predators copy (built on first injection)
+    GenomeTable genomes;                            ///< Every live genotype once; orgs (and pending births) hold references
+    Phylogeny phylo;                                ///< Taxa of living orgs and their common ancestors
+
   public:  
 
     BeakerWorld(BeakerConfig & _config)
-      : config(_config), id_map(), r_manager(_config), next_id(0), 
-        hm_size(config.HM_SIZE()), inst_lib(), event_lib(), 
-        signalgp_mutator(), surface({config.WORLD_X(), config.WORLD_Y()})
+      : config(_config), r_manager(_config), next_id(0), 
+        hm_size(config.HM_SIZE()), inst_lib(), event_lib(), brain_pool(inst_lib, event_lib),
+        signalgp_mutator(), worker_pool(std::max<size_t>(1, config.THREAD_NUM())),
+        grid(config.WORLD_X(), config.WORLD_Y(), std::max(config.MAX_RAD_VAL(), RES_RADIUS)),
+        field(config.WORLD_X(), config.WORLD_Y(), config.FIELD_CELL(), config.FIELD_CAPACITY(), config.FIELD_DIFFUSION(), config.FIELD_REGROWTH()),
+        stats(config.HM_SIZE(), config.MIN_RAD_VAL(), config.MAX_RAD_VAL())
     {
       random_ptr = emp::NewPtr<emp::Random>(config.SEED());
+      ConfigLists();
       ConfigAll();
+      // A resumed run carries on the series it was checkpointed from, so its files are appended to.
+      const bool resume = config.RESTORE_FILE() != "";
+      if(config.STATS_FILE() != "")
+      {
+        stats_rec = emp::NewPtr<StatsRecorder>(config.STATS_FILE(), config.STATS_CSV(), StatsColumns(), 256, resume);
+      }
+      if(config.PHYLO_FILE() != "")
+      {
+        phylo_file.open(config.PHYLO_FILE(), resume ? std::ios::app : std::ios::out);
+        if(!phylo_file.is_open())
+        {
+          std::cerr << "ERROR: Could not open phylogeny file " << config.PHYLO_FILE() << std::endl;
+          exit(-1);
+        }
+        if(!resume) { phylo_file << Phylogeny::Header() << "\n"; }
+      }
     }
 
     ~BeakerWorld() 
     { 
       Clear();
-      id_map.clear();  
       kill_list.clear();
       birth_list.clear();
+      eater_list.clear();
       eaten_list.clear();
-      while(!events.empty()) {events.pop();}
+      eaten_by.clear();
+      events.clear();
+      if(stats_rec) { stats_rec.Delete(); }
       random_ptr.Delete();
     }
 
@@ -132,67 +234,138 @@ class BeakerWorld : public emp::World<BeakerOrg>
     void ConfigWorld();           ///< Function will configure the world
     void ConfigMut();             ///< Function will configure the mutation operator
     void ConfigInst();            ///< Function will configure the instructions and instrucion library
-    void ConfigSurface();            ///< Function will configure the surface
+    void ConfigEvents();          ///< Function will configure the events and event library
     void ConfigOnUp();            ///< Function will configure the OnUpdate function
+    void ConfigLists();           ///< Function will preallocate the event lists and queue
     void InitialInject();         ///< Function inject the initial population into the world
     size_t Calc_Heat(double r);    ///< Function will calculate an orgs heat signature
+    int BrainSeed(size_t id);      ///< Function will calculate the seed of an orgs brain
+    CounterRandom RandomFor(Stream stream, size_t id, size_t update) const   ///< Stream for id at an update
+    {
+      return CounterRandom((uint64_t) random_ptr->GetSeed(), update, id, (uint32_t) stream);
+    }
+    CounterRandom RandomFor(Stream stream, size_t id) const { return RandomFor(stream, id, GetUpdate()); }
 
 
     /* Getter and setter functions for statistics! */
 
-    int GetStv() {return death_stv;}            ///< Function dedicated to keeping track of world deaths
-    int GetEat() {return death_eat;}
-    int GetPop() {return death_pop;}
-
-    int GetBlue() {return blue_cnt;}            ///< Functions dedicated to returning population distributions
-    int GetCyan() {return cyan_cnt;}
-    int GetLime() {return lime_cnt;}
-    int GetYellow() {return yellow_cnt;}
-    int GetRed() {return red_cnt;}
-    int GetWhite() {return white_cnt;}
+    int GetStv() {return stats.GetStv();}            ///< Function dedicated to keeping track of world deaths
+    int GetEat() {return stats.GetEat();}
+    int GetPop() {return stats.GetPop();}
+
+    int GetHeatCnt(size_t h) {return stats.GetHeatHist().GetCount(h);}            ///< Functions dedicated to returning population distributions
+    double GetHeatAvg(size_t h) {return stats.GetHeatHist().GetMean(h);}
+    double GetHeatVar(size_t h) {return stats.GetHeatHist().GetVariance(h);}
+    const HeatHistogram & GetHeatHist() const {return stats.GetHeatHist();}
+    const WorldStats & GetStats() const {return stats;}                          ///< Cheap: everything is kept up to date per event
+    const GenomeTable & GetGenomes() const {return genomes;}
+    size_t GetNumGenotypes() const {return genomes.GetNumGenotypes();}            ///< Distinct programs alive (no scan needed)
+    const Phylogeny & GetPhylogeny() const {return phylo;}
+
+    int GetBlue() {return GetHeatCnt(0);}       ///< Named heat signatures used by the web interface
+    int GetCyan() {return GetHeatCnt(1);}
+    int GetLime() {return GetHeatCnt(2);}
+    int GetYellow() {return GetHeatCnt(3);}
+    int GetRed() {return GetHeatCnt(4);}
+    int GetWhite() {return GetHeatCnt(5);}
 
     size_t GetResSize() {return config.NUMBER_RESOURCES();}               ///< Functions dedicated to returning container sizes
-    size_t GetIDSize() {return id_map.size();}
     size_t GetNextID() {return next_id;}
 
+    size_t GetPopSize() {return pop.size();}
+    const OrgTable & GetOrgTable() const {return orgs;}            ///< Will return organism physics for drawing
     bool GetRedraw() {return redraw;}                            ///< Will return the variable to determine if we need to redraw
 
-    std::string GetAvgBlue() {return Precision(avg_blue);}       ///< Functions dedicated to returning population distributions
-    std::string GetAvgCyan() {return Precision(avg_cyan);}
-    std::string GetAvgLime() {return Precision(avg_lime);}
-    std::string GetAvgYellow() {return Precision(avg_yellow);}
-    std::string GetAvgRed() {return Precision(avg_red);}
-    std::string GetAvgWhite() {return Precision(avg_white);}
+    std::string GetAvgBlue() {return Precision(GetHeatAvg(0));}       ///< Functions dedicated to returning population distributions
+    std::string GetAvgCyan() {return Precision(GetHeatAvg(1));}
+    std::string GetAvgLime() {return Precision(GetHeatAvg(2));}
+    std::string GetAvgYellow() {return Precision(GetHeatAvg(3));}
+    std::string GetAvgRed() {return Precision(GetHeatAvg(4));}
+    std::string GetAvgWhite() {return Precision(GetHeatAvg(5));}
 
 
     /* Functions dedicated to calculating statistics! */
      
-    void Col_Birth(size_t h);                             ///< Will increment number of heat signatures
-    void Col_Death(size_t h);                             ///< Will decrement number of heat signatures
-    void Sum_Rad(size_t h, double radius);                ///< Will calculate average radius per heat signature
-    void Calc_Rad();                                      ///< Divide each sum of radii by the color count
-    void Reset_Avg();                                     ///< Resets Average before every run
     std::string Precision(double radius);                 ///< Will set double to 3 precision
+    void PrintSummary(std::ostream & os);                 ///< Will print a one line summary of the world
+    emp::vector<std::string> StatsColumns() const;        ///< Names of the columns RecordStats writes
+    void RecordStats();                                   ///< Will append one row of statistics to the stats file
+    void RecordPhylogeny();                               ///< Will append a snapshot of the phylogeny to the phylogeny file
+
+
+    /* Instructions BeakerWorld adds to SignalGP (the static dispatch path calls these directly) */
+
+    void Inst_Vroom(hardware_t & hw, const inst_t & inst);                   ///< Move forward
+    void Inst_SpinRight(hardware_t & hw, const inst_t & inst);               ///< Rotate -5 degrees
+    void Inst_SpinLeft(hardware_t & hw, const inst_t & inst);                ///< Rotate 5 degrees
+    void Inst_Consume(hardware_t & hw, const inst_t & inst);                 ///< Eat whatever overlaps
+    void Inst_SenseRes(hardware_t & hw, const inst_t & inst);                ///< Nearest resource: distance, bearing
+    void Inst_SenseLarger(hardware_t & hw, const inst_t & inst);             ///< Nearest larger org: distance, bearing
+    void Inst_SenseSmaller(hardware_t & hw, const inst_t & inst);            ///< Nearest smaller org: distance, bearing
+    void Inst_SenseDensity(hardware_t & hw, const inst_t & inst);            ///< Number of orgs in range
 
 
     /* Functions dedicated to the physics of the system */
 
     bool PairCollision(BeakerOrg & body1, BeakerOrg & body2) {return true;}   ///< Function dedicated to dealing with organims collisions [TODO]
+    void OrgOverlap(BeakerOrg & pred, BeakerOrg & prey);                      ///< Organism overlaps another organism
+    void ResOverlap(BeakerOrg & org, BeakerResource & res);                   ///< Organism overlaps a resource
+    bool CanEatRes(double radius) const;                                      ///< Is an org small enough to eat resources?
+    void FieldConsume(BeakerOrg & org);                                       ///< Organism eats from the field cell under it
+    void StepField();                                                         ///< Diffuse and regrow the field (rows in parallel)
+    emp::Point ResSpawnPoint(CounterRandom & random);                         ///< Where a resource (re)spawns, by RESOURCE_SPAWN
+    void RespawnResources();                                                  ///< Expire and respawn the resources due this update
+    void FindOverlap(BeakerOrg & org);                                        ///< Trigger overlaps of org using the grid
+    const Percept & Perceive(size_t wid);                                     ///< Sense the surroundings of an org (once per update)
+    double Bearing(size_t wid, const emp::Point & offset) const;              ///< Degrees from an org's heading to an offset
+    void Raise(size_t wid, Signal sig) { if(config.SIGNALS()) { signals[wid] |= 1 << (size_t) sig; } }  ///< Signal an org at the start of next update
+    bool Latch(size_t wid, Signal sig, bool on);                              ///< Track a level; true when it just turned on
+    void DeliverSignals(size_t wid);                                          ///< Start cores in an org's brain for its pending signals
+    void ApplyIntents(BeakerOrg & org);                                       ///< Apply actions recorded by an orgs brain
+    void Feed(size_t wid, double e, WorldStats::Food food);                   ///< Give an org energy (up to the cap) and record the intake
+    size_t WorldIDOf(hardware_t & hw)                                         ///< World id of the org that owns a brain
+    {
+      return (size_t) hw.GetTrait((size_t) BeakerOrg::Trait::WRL_ID);
+    }
+    emp::Ptr<BeakerOrg> OrgOf(hardware_t & hw) { return pop[WorldIDOf(hw)]; }  ///< Org that owns a brain (slot in pop)
     void ProcessEvents();                                                     ///< Process all the events in order!
+    void ProcessBirths();                                                     ///< Mutate this update's offspring in parallel, then place them
+    void MutateBirth(PendingBirth & b, program_t & program);                  ///< Mutate one offspring (in program) using only its own streams
+    void PlaceOffspring(emp::Ptr<BeakerOrg> org, size_t parent);              ///< Put a new offspring on the surface and in pop
+    size_t TakeWorldID();                                                     ///< World id for a new org (a dead org's slot if there is one)
+    bool Listed(const emp::vector<size_t> & list, size_t id) const { return id < list.size() && list[id] == cur_stamp; }
+    void List(emp::vector<size_t> & list, size_t id) { emp_assert(id < list.size(), id); list[id] = cur_stamp; }
+    void Unlist(emp::vector<size_t> & list, size_t id) { if(id < list.size()) {list[id] = 0;} }
     void SetRedraw(bool b) {redraw = b;}                                      ///< Return redraws variable for UI
-    surface_t & GetSurface() { return surface; }                              ///< Will return the surface that orgs/resources are!
+    const SpatialGrid & GetSurface() const { return grid; }                   ///< Will return the surface that orgs/resources are!
+    const ResourceField & GetField() const { return field; }                  ///< Will return the food field (RESOURCE_MODE 1)
+    const ResourceManager & GetResources() const { return r_manager; }        ///< Will return the resource bodies' manager (read only)
+    bool UseField() const { return config.RESOURCE_MODE() == 1; }             ///< Is food a field rather than resource bodies?
 
 
     /* Functions dedicated for experiment functionality */
 
-    double MutRad(double r, BeakerOrg & org);                                 ///< Function will mutate radius, if possible
-    void InjectApex();                                                        ///< Will inject a preditor to the world...
+    double MutRad(double r, CounterRandom & random);                          ///< Function will mutate radius, if possible
+    size_t MutateProgram(program_t & program, size_t id);                     ///< Mutate the program of the org that gets map id, return mutation count
+    size_t InjectOrg(const BeakerOrg & org, double rad);                      ///< Inject a copy of org at a random spot, return its world id
+    void PushPattern(PackedGenome & genome, const emp::vector<std::string> & names, size_t times);  ///< Push names times over
+    void BuildStart(PackedGenome & genome);                                   ///< Will build the initial population's genome
+    void BuildApex(PackedGenome & genome);                                    ///< Will load the preditor genome (file or default)
+    void InjectApex(size_t num);                                              ///< Will inject num preditors to the world...
+
+
+    /* Functions dedicated to checkpoints */
+
+    static constexpr uint32_t CHECKPOINT_MAGIC = 0x4B434257;                  ///< "BWCK"
+    static constexpr uint32_t CHECKPOINT_VERSION = 11;
+    bool SaveCheckpoint(const std::string & path);                            ///< Write the whole run state between updates
+    void LoadCheckpoint(const std::string & path);                            ///< Bring a run back to a saved update
 
 
     /* Functions dedicated to debugging the system */
 
     void PrintLists();                                         ///< Will print all the lists we have
-    void PrintQueue(std::queue<event_t> copy_queue);           ///< Will print Events queue
+    void PrintQueue();                                         ///< Will print Events queue
 };
 
 /* Functions dedicated to the initilization of the run */
@@ -202,7 +375,7 @@ void BeakerWorld::ConfigAll()  ///< Function will run all Config_* functions!
     ConfigWorld();
     ConfigMut();
     ConfigInst();
-    ConfigSurface();
+    ConfigEvents();
     ConfigOnUp();
     InitialInject();
 }
@@ -211,42 +384,24 @@ void BeakerWorld::ConfigWorld() ///< Function dedicated to configuring the world
 {
   SetPopStruct_Grow(false); // Don't automatically delete organism when new ones are born.
 
-  // Setup organism to share parent's surface features.
-  OnOffspringReady([this](BeakerOrg & org, size_t parent_pos)
-  {
-    // Reset offspring's hardware so no issues arise
-    org.GetBrain().ResetHardware();
-    org.GetBrain().SpawnCore(0, memory_t(), true);
-    org.SetEnergy(config.INIT_ENERGY());
-
-    // Set parent attributes to offspring
-    emp::Point parent_center = surface.GetCenter(GetOrg(parent_pos).GetSurfaceID());
-    double parent_radius = surface.GetRadius(GetOrg(parent_pos).GetSurfaceID());
-
-    // Mutate the offspring radius!
-    double off_radius;
-    (config.TESTING()) ? off_radius = parent_radius : off_radius = MutRad(parent_radius, org);
-
-    size_t heat = Calc_Heat(off_radius);
-    org.SetHeatID(heat);
-
-    // Mutate the offspirng genome
-    if(!config.TESTING()) {DoMutationsOrg(org);}
-
-    // Add to the surface and set its surface id!
-    size_t surf_id = surface.AddBody(&org, parent_center, off_radius, heat);
-    org.SetSurfaceID(surf_id);
-    org.SetTrait((size_t)BeakerOrg::Trait::HEAT_ID, heat);
-
-    // Keep track of organism heat signature.
-    Col_Birth(heat);
-  });
-
-  // Make sure that we are tracking organisms by their IDs once placed.
+  // Give organisms their ids once placed; WRL_ID lets instructions find their org directly.
   OnPlacement([this](size_t pos)
   {
-    // Set appropiate traits and store in map_id for future access
+    // Set appropiate traits (map id is unique, world id is the slot in pop)
     size_t id = next_id++;
+
+    // Make sure the lists have room for this world id (grows geometrically, not every update).
+    if(pos >= kill_list.size())
+    {
+      const size_t size = std::max(pos + 1, 2 * kill_list.size());
+      kill_list.resize(size, 0);
+      birth_list.resize(size, 0);
+      eater_list.resize(size, 0);
+      percepts.resize(size);
+      signals.resize(size, 0);
+      orgs.Resize(size);
+    }
+    signals[pos] = 0;
     GetOrg(pos).SetWorldID(pos);
     GetOrg(pos).SetMapID(id);
     // std::cerr << "****" << GetOrg(pos).GetSurfaceID() << std::endl;
@@ -256,22 +411,48 @@ void BeakerWorld::ConfigWorld() ///< Function dedicated to configuring the world
     // std::cerr << "****ps" << pos << std::endl;
 
     GetOrg(pos).SetTrait((size_t)BeakerOrg::Trait::MAP_ID, id);
+    genomes.AddRef(GetOrg(pos).GetGenomeID());
+    phylo.AddRef(GetOrg(pos).GetTaxonID());
+    // Every brain owns its generator so brains can run on any thread; reseed it for this org.
+    GetOrg(pos).GetBrain().GetRandom().ResetSeed(BrainSeed(id));
     GetOrg(pos).SetTrait((size_t)BeakerOrg::Trait::WRL_ID, pos);
-    id_map[id] = &GetOrg(pos);
+
+    // Every placed org gets a random spin on its facing.
+    emp::Angle facing = (birth_ready) ? birth.facing : emp::Angle();
+    facing.RotateDegrees(RandomFor(Stream::FACING, id).GetDouble(360.0));
+
+    // Offspring are already on the surface, so let the grid know who they are.
+    // Injected orgs are put on the surface (and in the table) by the injector.
+    if(birth_ready)
+    {
+      orgs.Add(pos, birth.center, birth.radius, facing, config.INIT_ENERGY(), birth.heat);
+      stats.AddOrg(birth.heat, birth.radius, config.INIT_ENERGY());
+      grid.SetOwner(GetOrg(pos).GetSurfaceID(), pos);
+      birth_ready = false;
+    }
+    else
+    {
+      orgs.SetFacing(pos, facing);
+    }
   });
 
   // Trigger for an organisms death.
   OnOrgDeath( [this](size_t w_pos) 
   {
     // Remove id from these lists 
-    birth_list.erase(w_pos);
-    eater_list.erase(w_pos);
-    kill_list.erase(w_pos);
-
-    // Keep track of org deaths and remove from id_map and surface!
-    Col_Death(GetOrg(w_pos).GetHeatID());
-    surface.RemoveBody(GetOrg(w_pos).GetSurfaceID());
-    id_map.erase(GetOrg(w_pos).GetMapID());
+    Unlist(birth_list, w_pos);
+    Unlist(eater_list, w_pos);
+    Unlist(kill_list, w_pos);
+
+    // Keep track of org deaths and remove from surface!
+    stats.RemoveOrg(orgs.GetHeat(w_pos), orgs.GetRadius(w_pos), orgs.GetEnergy(w_pos));
+    genomes.Release(GetOrg(w_pos).GetGenomeID());
+    phylo.Release(GetOrg(w_pos).GetTaxonID());
+    grid.RemoveBody(GetOrg(w_pos).GetSurfaceID());
+    orgs.Remove(w_pos);
+
+    // The slot goes to the next org, so the lists and table stay the size of the live population.
+    free_wids.push_back(w_pos);
   });
 }
 
@@ -282,6 +463,12 @@ void BeakerWorld::ConfigMut() ///< Function dedicated to configuring the mutatio
   signalgp_mutator.SetProgMaxFuncCnt(config.PROGRAM_MAX_FUN_CNT());
   signalgp_mutator.SetProgMinFuncLen(config.PROGRAM_MIN_FUN_LEN());
   signalgp_mutator.SetProgMaxFuncLen(config.PROGRAM_MAX_FUN_LEN());
+  // Genomes are stored packed, which limits the argument range.
+  if(config.PROGRAM_MIN_ARG_VAL() < 0 || config.PROGRAM_MAX_ARG_VAL() > PackedGenome::MAX_ARG)
+  {
+    std::cerr << "ERROR: Program arguments must lie in [0, " << PackedGenome::MAX_ARG << "]" << std::endl;
+    exit(-1);
+  }
   signalgp_mutator.SetProgMinArgVal(config.PROGRAM_MIN_ARG_VAL());
   signalgp_mutator.SetProgMaxArgVal(config.PROGRAM_MAX_ARG_VAL());
   signalgp_mutator.SetProgMaxTotalLen(config.PROGRAM_MAX_FUN_CNT() * config.PROGRAM_MAX_FUN_LEN());
@@ -340,95 +527,92 @@ void BeakerWorld::ConfigInst() ///< Function dedicated to configuring instructio
   inst_lib.AddInst("Break", hardware_t::Inst_Break, 0, "Break out of current block.");
 
   // Setup new instructions for the instruction set.
-  inst_lib.AddInst("Vroom", [this](hardware_t & hw, const inst_t & inst) 
-  {
-    const size_t id = (size_t) hw.GetTrait((size_t) BeakerOrg::Trait::MAP_ID);
-    emp::Ptr<BeakerOrg> org_ptr = id_map[id];
-    emp::Angle facing = org_ptr->GetFacing();
-    double dis = 1.5 - (org_ptr->GetRadius() / 7.0);
-    surface.TranslateWrap( org_ptr->GetSurfaceID(), facing.GetPoint(dis));
-    }, 1, "Move forward.");
-
-  inst_lib.AddInst("SpinRight", [this](hardware_t & hw, const inst_t & inst) mutable 
-  {
-    const size_t id = (size_t) hw.GetTrait((size_t) BeakerOrg::Trait::MAP_ID);
-    emp::Ptr<BeakerOrg> org_ptr = id_map[id];
-    org_ptr->RotateDegrees(-5.0);
-  }, 1, "Rotate -5 degrees.");
+  inst_lib.AddInst("Vroom", [this](hardware_t & hw, const inst_t & inst) { Inst_Vroom(hw, inst); }, 1, "Move forward.");
+  inst_lib.AddInst("SpinRight", [this](hardware_t & hw, const inst_t & inst) { Inst_SpinRight(hw, inst); }, 1, "Rotate -5 degrees.");
+  inst_lib.AddInst("SpinLeft", [this](hardware_t & hw, const inst_t & inst) { Inst_SpinLeft(hw, inst); }, 1, "Rotate 5 degrees.");
+  inst_lib.AddInst("Consume", [this](hardware_t & hw, const inst_t & inst) { Inst_Consume(hw, inst); }, 1, "Consume a resource!");
+  inst_lib.AddInst("SenseRes", [this](hardware_t & hw, const inst_t & inst) { Inst_SenseRes(hw, inst); }, 2, "Local memory: Arg1 = distance, Arg2 = bearing of nearest resource.");
+  inst_lib.AddInst("SenseLarger", [this](hardware_t & hw, const inst_t & inst) { Inst_SenseLarger(hw, inst); }, 2, "Local memory: Arg1 = distance, Arg2 = bearing of nearest larger org.");
+  inst_lib.AddInst("SenseSmaller", [this](hardware_t & hw, const inst_t & inst) { Inst_SenseSmaller(hw, inst); }, 2, "Local memory: Arg1 = distance, Arg2 = bearing of nearest smaller org.");
+  inst_lib.AddInst("SenseDensity", [this](hardware_t & hw, const inst_t & inst) { Inst_SenseDensity(hw, inst); }, 1, "Local memory: Arg1 = number of orgs in range.");
+
+#ifdef BEAKER_STATIC_DISPATCH
+  // The static path turns instruction ids straight into opcodes.
+  static_dispatch::CheckOrder(inst_lib);
+#endif
+}
 
-  inst_lib.AddInst("SpinLeft", [this](hardware_t & hw, const inst_t & inst) mutable 
-  {
-    const size_t id = (size_t) hw.GetTrait((size_t) BeakerOrg::Trait::MAP_ID);
-    emp::Ptr<BeakerOrg> org_ptr = id_map[id];
-    org_ptr->RotateDegrees(5.0);
-  }, 1, "Rotate 5 degrees.");
+void BeakerWorld::Inst_Vroom(hardware_t & hw, const inst_t & inst) ///< Move forward
+{
+  emp::Ptr<BeakerOrg> org_ptr = OrgOf(hw);
+  const size_t wid = org_ptr->GetWorldID();
+  emp::Angle facing = orgs.GetFacing(wid);
+  double dis = 1.5 - (orgs.GetRadius(wid) / 7.0);
+  org_ptr->PushIntent(BeakerOrg::Intent::Type::MOVE, facing.GetPoint(dis));   // Moved in ApplyIntents
+}
 
-  inst_lib.AddInst("Consume", [this](hardware_t & hw, const inst_t & inst) mutable 
-  {
-    const size_t id = (size_t) hw.GetTrait((size_t) BeakerOrg::Trait::MAP_ID);
-    emp::Ptr<BeakerOrg> org_ptr = id_map[id];
-    surface.FindOverlap( org_ptr->GetSurfaceID() );  // Surface functions automatically try to eat on overlap!
-  }, 1, "Consume a resource!");
+void BeakerWorld::Inst_SpinRight(hardware_t & hw, const inst_t & inst) ///< Rotate -5 degrees
+{
+  orgs.RotateDegrees(WorldIDOf(hw), -5.0);   // Facing only belongs to this org, so no intent is needed
 }
 
-void BeakerWorld::ConfigSurface() ///< Function dedicated to configure the surface
+void BeakerWorld::Inst_SpinLeft(hardware_t & hw, const inst_t & inst) ///< Rotate 5 degrees
 {
-    surface.AddOverlapFun( [this](BeakerOrg & pred, BeakerOrg & prey) 
-    {
-        // Get orgs surface id
-        const size_t pred_sid = pred.GetSurfaceID();
-        const size_t prey_sid = prey.GetSurfaceID();
-        // Get org world id
-        const size_t prey_wid = prey.GetWorldID();
-        // Use surface id to get radius
-        const double pred_rd = surface.GetRadius(pred_sid);
-        const double prey_rd = surface.GetRadius(prey_sid);
-        // Caluculate upper and lowerbounds
-        const double lower_b = pred_rd * config.MIN_CONSUME_RATIO();
-        const double upper_b = pred_rd + (pred_rd * config.MAX_CONSUME_RATIO());
-
-        // If prey radius is within pred radius bound
-        if(lower_b < prey_rd && prey_rd < upper_b)
-        {
-            if(kill_list.find(prey_wid) == kill_list.end())
-            {
-                // std::cerr << "ORG EATEN!" << std::endl;
-                pred.AddEnergy(prey.GetEnergy() * config.EAT_ORG_ENERGRY_PROP(), config.MAX_ENERGY_CAP());
-                kill_list.insert(prey_wid);
-                events.push(std::make_pair((size_t)Trait::KILLED, prey_wid));
-                death_eat++;
-                redraw = true;
-                // std::cerr << "ORG-EATEN: " << lower_b << " < " << prey_rd << "_(" << prey_wid << "-" << prey_sid  << ")"  << " < " << upper_b << "_(" << pred_wid << "-" << pred_sid  << ")" << std::endl;        
-            }
-        }
-    });
-    surface.AddOverlapFun( [this](BeakerOrg & org, BeakerResource & res) 
-    {
-        // Get org values
-        const size_t org_sid = org.GetSurfaceID();
-        const size_t org_wid = org.GetWorldID();
-        const double org_rd = surface.GetRadius(org_sid);
-        // Get resoruce vector id for position tracking
-        const size_t res_vid =  res.GetMapID();
-        // Calcluate threshold
-        const double thresh = ((config.MAX_RAD_VAL()-config.MIN_RAD_VAL()) * config.CONSUME_RES_THRESH()) + config.MIN_RAD_VAL();
-
-        // If the resource has not been eaten yet and the size requirement is met
-        if(eaten_list.find(res_vid) == eaten_list.end() && org_rd <= thresh)
-        {
-            // We store the resource id and the organism world_id that ate it. 
-            eaten_list[res_vid] = org_wid;
-            eater_list.insert(org_wid);
-            events.push(std::make_pair((size_t)Trait::CONSUME, res_vid)); 
-            // std::cerr << "RES-EATEN: " << org_sid << ", " << org_wid << std::endl;
-        }
-    });
-    surface.AddOverlapFun( [](BeakerResource &, BeakerResource &) {
-      std::cerr << "ERROR: Resources should not try to eat other resources!" << std::endl;
-    });
-    surface.AddOverlapFun( [](BeakerResource &, BeakerOrg &) {
-      std::cerr << "ERROR: Resources should not try to eat organisms!" << std::endl;
-    });
+  orgs.RotateDegrees(WorldIDOf(hw), 5.0);
+}
+
+void BeakerWorld::Inst_Consume(hardware_t & hw, const inst_t & inst) ///< Eat whatever overlaps
+{
+  emp::Ptr<BeakerOrg> org_ptr = OrgOf(hw);
+  org_ptr->PushIntent(BeakerOrg::Intent::Type::CONSUME);  // Overlaps are found in ApplyIntents
+}
+
+void BeakerWorld::Inst_SenseRes(hardware_t & hw, const inst_t & inst) ///< Nearest resource: distance, bearing
+{
+  const Percept & percept = Perceive(WorldIDOf(hw));
+  hw.GetCurState().SetLocal(inst.args[0], percept.res_dist);
+  hw.GetCurState().SetLocal(inst.args[1], percept.res_bearing);
+}
+
+void BeakerWorld::Inst_SenseLarger(hardware_t & hw, const inst_t & inst) ///< Nearest larger org: distance, bearing
+{
+  const Percept & percept = Perceive(WorldIDOf(hw));
+  hw.GetCurState().SetLocal(inst.args[0], percept.larger_dist);
+  hw.GetCurState().SetLocal(inst.args[1], percept.larger_bearing);
+}
+
+void BeakerWorld::Inst_SenseSmaller(hardware_t & hw, const inst_t & inst) ///< Nearest smaller org: distance, bearing
+{
+  const Percept & percept = Perceive(WorldIDOf(hw));
+  hw.GetCurState().SetLocal(inst.args[0], percept.smaller_dist);
+  hw.GetCurState().SetLocal(inst.args[1], percept.smaller_bearing);
+}
+
+void BeakerWorld::Inst_SenseDensity(hardware_t & hw, const inst_t & inst) ///< Number of orgs in range
+{
+  hw.GetCurState().SetLocal(inst.args[0], Perceive(WorldIDOf(hw)).density);
+}
+
+void BeakerWorld::ConfigEvents() ///< Function dedicated to configuring events and event library
+{
+  // An event starts a core on the function whose tag best matches the signal's tag.
+  auto spawn = [](hardware_t & hw, const hw_event_t & event) { hw.SpawnCore(event.affinity, hw.GetMinBindThresh(), event.msg); };
+  event_lib.AddEvent("Collided", spawn, "Bumped into another organism.");
+  event_lib.AddEvent("EnergyLow", spawn, "Energy dropped below SIGNAL_ENERGY_LOW.");
+  event_lib.AddEvent("ResNear", spawn, "A resource came within SIGNAL_RES_RANGE.");
+  event_lib.AddEvent("Attacked", spawn, "Survived a bite from a larger organism (too small for it to eat).");
+
+  // Tags far apart in Hamming distance, so each signal can bind its own function.  Events carry
+  // no message (details are there to sense) and are built once here.
+  static constexpr uint16_t SIGNAL_TAGS[NUM_SIGNALS] = {0x0F0F, 0xF0F0, 0x00FF, 0xFF00};
+  static constexpr const char * SIGNAL_NAMES[NUM_SIGNALS] = {"Collided", "EnergyLow", "ResNear", "Attacked"};
+  signal_events.clear();
+  for(size_t sig = 0; sig < NUM_SIGNALS; ++sig)
+  {
+    prog_tag_t tag;
+    tag.SetUInt(0, SIGNAL_TAGS[sig]);
+    signal_events.emplace_back(event_lib.GetID(SIGNAL_NAMES[sig]), tag);
+  }
 }
 
 void BeakerWorld::ConfigOnUp() ///< Function dedicated to configuring the OnUpdate function
@@ -436,6 +620,10 @@ void BeakerWorld::ConfigOnUp() ///< Function dedicated to configuring the OnUpda
   // On each update, run organisms and make sure they stay on the surface.
   OnUpdate([this](size_t)
   {
+    // Anything listed during an earlier update is no longer on a list.
+    cur_stamp = GetUpdate() + 1;
+    stats.BeginUpdate(GetUpdate() + 1);
+
     // Store all active ids and then reshuffle them!
     for(size_t pos = 0; pos < pop.size(); pos++)
     {
@@ -445,122 +633,400 @@ void BeakerWorld::ConfigOnUp() ///< Function dedicated to configuring the OnUpda
       } 
       scheduler.push_back(pos);
     }
-    emp::Shuffle(*random_ptr, scheduler);
-
-    for(size_t pos : scheduler) { ProcessID(pos, config.PROCESS_NUM()); }
-
+    CounterRandom schedule_random = RandomFor(Stream::SCHEDULE, 0);
+    Shuffle(schedule_random, scheduler);
 
-    // Update each organism.
-    for (size_t pos : scheduler) 
+    // Run every brain (after handing it last update's signals).  World-affecting instructions only
+    // record intents, so brains are independent.
+#ifdef BEAKER_STATIC_DISPATCH
+    worker_pool.ParallelFor(scheduler.size(), [this](size_t i)
+    {
+      DeliverSignals(scheduler[i]);
+      static_dispatch::Process(pop[scheduler[i]]->GetBrain(), config.PROCESS_NUM(), *this);
+    });
+#else
+    worker_pool.ParallelFor(scheduler.size(), [this](size_t i)
     {
-      // If position contains a NullPtr skippppppp
+      DeliverSignals(scheduler[i]);
+      ProcessID(scheduler[i], config.PROCESS_NUM());
+    });
+#endif
 
-      auto & org = *pop[pos];
+    // Apply the intents in scheduler order; results do not depend on the number of threads.
+    for(size_t pos : scheduler) { ApplyIntents(*pop[pos]); }
 
-      // Subtract energy per update call
-      org.SubEnergy(config.ENERGY_REDUCTION() * (org.GetRadius() / 7.0));
+    // Subtract energy per update call from every org and flag births/starvations in one sweep over the table.
+    orgs.Sweep(config.ENERGY_REDUCTION() / 7.0, config.REPRODUCTION_THRESH(), birth_mask, starve_mask);
+    stats.Metabolize(config.ENERGY_REDUCTION() / 7.0);
 
+    // Queue the flagged organisms in scheduler order.
+    for (size_t pos : scheduler) 
+    {
       // If an organism has enough energy to reproduce, store id.
-      if (org.GetEnergy() > config.REPRODUCTION_THRESH()) 
+      if (OrgTable::Test(birth_mask, pos)) 
       {
-        birth_list.insert(org.GetWorldID());
-        events.push(std::make_pair((size_t)Trait::BIRTH, org.GetWorldID()));
+        List(birth_list, pos);
+        events.push(std::make_pair((size_t)Trait::BIRTH, pos));
         redraw = true;
       }
       // If an organism starves to death, store id.
-      if (org.GetEnergy() <= 0.0)
+      if (OrgTable::Test(starve_mask, pos))
       {
-        death_stv++;
-        kill_list.insert(org.GetWorldID());
-        events.push(std::make_pair((size_t)Trait::KILLED, org.GetWorldID()));
+        stats.CountDeath(WorldStats::Death::STARVED);
+        List(kill_list, pos);
+        events.push(std::make_pair((size_t)Trait::KILLED, pos));
         redraw = true;
       }
     }
     ProcessEvents();
-    if(GetUpdate() == config.PRED_INJECT()) {InjectApex();}
+    RespawnResources();
+    if(UseField()) { StepField(); }
+    if(GetUpdate() == config.PRED_INJECT()) {InjectApex(config.PRED_INJECT_NUM());}
     scheduler.clear();
   });
 }
 
+void BeakerWorld::ConfigLists() ///< Function dedicated to preallocating the event lists and queue
+{
+  kill_list.resize(config.MAX_POP_SIZE(), 0);
+  birth_list.resize(config.MAX_POP_SIZE(), 0);
+  eater_list.resize(config.MAX_POP_SIZE(), 0);
+  percepts.resize(config.MAX_POP_SIZE());
+  signals.resize(config.MAX_POP_SIZE(), 0);
+  eaten_list.resize(config.NUMBER_RESOURCES(), 0);
+  eaten_by.resize(config.NUMBER_RESOURCES(), 0);
+  res_expired.reserve(config.NUMBER_RESOURCES());
+  res_respawn.reserve(config.NUMBER_RESOURCES());
+  res_points.reserve(config.NUMBER_RESOURCES());
+  pending.reserve(config.MAX_POP_SIZE());
+  free_wids.reserve(config.MAX_POP_SIZE());
+  while(scratch.size() < worker_pool.GetNumThreads()) { scratch.emplace_back(&inst_lib); }
+  // Sized, not just reserved: placement sets an org's facing before orgs.Add fills its slot.
+  orgs.Resize(config.MAX_POP_SIZE());
+  birth_mask.reserve((config.MAX_POP_SIZE() + 63) / 64);
+  starve_mask.reserve((config.MAX_POP_SIZE() + 63) / 64);
+
+  // At most: every org is eaten, starves and gives birth, and every resource is consumed.
+  events.Reserve(3 * config.MAX_POP_SIZE() + config.NUMBER_RESOURCES());
+}
+
 void BeakerWorld::InitialInject() ///< Function dedicated to injection the initial population or organisms and resources
 {
-    // Add in resources.
-    for(size_t i = 0; i < config.NUMBER_RESOURCES(); ++i)
+    // Patch centers are fixed for the whole run.
+    emp::vector<emp::Point> patches;
+    for(size_t p = 0; p < config.RESOURCE_PATCHES(); ++p)
     {
-        //Place them randomly throughout the canvas and store their map_id
-        double x = random_ptr->GetDouble(config.WORLD_X());
-        double y = random_ptr->GetDouble(config.WORLD_Y());
+        CounterRandom random = RandomFor(Stream::PATCH, p, 0);
+        const double x = random.GetDouble(config.WORLD_X());
+        patches.emplace_back(x, random.GetDouble(config.WORLD_Y()));
+    }
+    r_manager.SetPatches(patches);
+
+    // Add in resources (a field needs no bodies).
+    for(size_t i = 0; i < config.NUMBER_RESOURCES() && !UseField(); ++i)
+    {
+        // Place them by the spawn distribution and store their map_id; lifetimes are staggered so they do not all expire at once.
+        CounterRandom random = RandomFor(Stream::RES_PLACE, i);
+        const emp::Point center = ResSpawnPoint(random);
         r_manager.SetMapID(i,i);
-        size_t sid = surface.AddBody(&r_manager.GetRes(i), {x,y}, 3.0, config.HM_SIZE());
+        size_t sid = grid.AddBody(SpatialGrid::Kind::RES, i, center, RES_RADIUS);
         r_manager.SetSurfaceID(i, sid);
+        const size_t life = config.RESOURCE_UPS_MAX();
+        r_manager.Spawn(i, GetUpdate(), (life) ? 1 + random.GetUInt(life) : 0);
     }
 
-    r_manager.PrintManager();
-
-    // Initialize a populaton of random organisms.
-    Inject(BeakerOrg(inst_lib, event_lib, random_ptr), 1);
-    for (size_t i = 0; i < 1; i++) 
+    // Initialize a populaton of random organisms; names are looked up once and the program copied from there.
+    BuildStart(start_genome);
+    BeakerOrg seed(&brain_pool);
+    start_genome.Decode(seed.GetBrain());
+    seed.SetGenomeID(genomes.Intern(start_genome));
+    seed.SetTaxonID(phylo.AddTaxon(Phylogeny::NONE, start_genome.Hash(), GetUpdate()));
+    for (size_t n = 0; n < 1; n++) 
     {
+        // Get organism
+        const size_t i = TakeWorldID();
+        InjectAt(seed, emp::WorldPosition(i));
+        BeakerOrg & org = GetOrg(i);
+
         // Random coordiantes for organism
-        double x = random_ptr->GetDouble(config.WORLD_X());
-        double y = random_ptr->GetDouble(config.WORLD_Y());
+        CounterRandom random = RandomFor(Stream::ORG_PLACE, org.GetMapID());
+        double x = random.GetDouble(config.WORLD_X());
+        double y = random.GetDouble(config.WORLD_Y());
 
         // Get random radius and calculate heat color
         double rad = 6.00000;
         size_t heat = Calc_Heat(rad);
-        Col_Birth(heat);
-
-        // Get organism
-        BeakerOrg & org = GetOrg(i);
-
-        // Add instructions
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom"); org.PushInst("Consume"); org.PushInst("Vroom"); org.PushInst("Vroom");
-        org.PushInst("SpinRight"); org.PushInst("SpinRight");
-        org.SetEnergy(config.INIT_ENERGY());
 
         // Add organism to the surface and store its id
-        size_t surf_id = surface.AddBody(&org, {x,y}, rad, heat);
+        size_t surf_id = grid.AddBody(SpatialGrid::Kind::ORG, i, {x,y}, rad);
         org.SetSurfaceID(surf_id);
-        org.SetHeatID(heat);
-        org.SetRadius(rad);
-        org.SetEnergy(config.INIT_ENERGY());
-        Sum_Rad(heat, surface.GetRadius(org.GetSurfaceID()));
+        orgs.Add(i, {x,y}, rad, orgs.GetFacing(i), config.INIT_ENERGY(), heat);
+        stats.AddOrg(heat, rad, config.INIT_ENERGY());
     }
-    
-    Calc_Rad();
 }
 
 
 /* Functions dedicated to calculating statistics! */
 
-void BeakerWorld::Reset_Avg()  ///< Resets Average before every run
+void BeakerWorld::OrgOverlap(BeakerOrg & pred, BeakerOrg & prey) ///< Organism overlaps another organism
 {
-  avg_blue = 0.0;
-  avg_cyan = 0.0;
-  avg_lime = 0.0;
-  avg_yellow = 0.0;
-  avg_red = 0.0;
-  avg_white = 0.0;
+  // Get org world id
+  const size_t pred_wid = pred.GetWorldID();
+  const size_t prey_wid = prey.GetWorldID();
+  // Use world id to get radius
+  const double pred_rd = orgs.GetRadius(pred_wid);
+  const double prey_rd = orgs.GetRadius(prey_wid);
+  // Caluculate upper and lowerbounds
+  const double lower_b = pred_rd * config.MIN_CONSUME_RATIO();
+  const double upper_b = pred_rd + (pred_rd * config.MAX_CONSUME_RATIO());
+
+  // If prey radius is within pred radius bound
+  if(lower_b < prey_rd && prey_rd < upper_b)
+  {
+    if(!Listed(kill_list, prey_wid))
+    {
+      Feed(pred_wid, orgs.GetEnergy(prey_wid) * config.EAT_ORG_ENERGRY_PROP(), WorldStats::Food::ORG);
+      List(kill_list, prey_wid);
+      events.push(std::make_pair((size_t)Trait::KILLED, prey_wid));
+      stats.CountDeath(WorldStats::Death::EATEN);
+      redraw = true;
+    }
+  }
+  // A larger org can only fail to eat an org that is below its window.
+  else if(pred_rd > prey_rd) { Raise(prey_wid, Signal::ATTACKED); }
+}
+
+void BeakerWorld::ResOverlap(BeakerOrg & org, BeakerResource & res) ///< Organism overlaps a resource
+{
+  // Get org values
+  const size_t org_wid = org.GetWorldID();
+  const double org_rd = orgs.GetRadius(org_wid);
+  // Get resoruce vector id for position tracking
+  const size_t res_vid =  res.GetMapID();
+
+  // If the resource has not been eaten yet and the size requirement is met
+  if(!Listed(eaten_list, res_vid) && CanEatRes(org_rd))
+  {
+    // We store the resource id and the organism world_id that ate it.
+    List(eaten_list, res_vid);
+    eaten_by[res_vid] = org_wid;
+    List(eater_list, org_wid);
+    events.push(std::make_pair((size_t)Trait::CONSUME, res_vid));
+  }
+}
+
+bool BeakerWorld::CanEatRes(double radius) const ///< Is an org small enough to eat resources?
+{
+  const double thresh = ((config.MAX_RAD_VAL()-config.MIN_RAD_VAL()) * config.CONSUME_RES_THRESH()) + config.MIN_RAD_VAL();
+  return radius <= thresh;
+}
+
+void BeakerWorld::FieldConsume(BeakerOrg & org) ///< Organism eats from the field cell under it
+{
+  // One lookup; intents are applied one org at a time, so the cell is never shared mid-bite.
+  const size_t wid = org.GetWorldID();
+  if(!CanEatRes(orgs.GetRadius(wid))) { return; }
+  const double taken = field.Take(orgs.GetCenter(wid), config.RESOURCE_POWERUP());
+  if(taken <= 0.0) { return; }
+  Feed(wid, taken, WorldStats::Food::RESOURCE);
+  stats.CountResEaten();
+}
+
+void BeakerWorld::StepField() ///< Diffuse and regrow the field (rows in parallel)
+{
+  worker_pool.ParallelFor(field.GetRows(), [this](size_t row) { field.StepRow(row); });
+  field.Swap();
+  redraw = true;
+}
+
+emp::Point BeakerWorld::ResSpawnPoint(CounterRandom & random) ///< Where a resource (re)spawns, by RESOURCE_SPAWN
+{
+  const ResourceManager::SpawnMode mode = r_manager.GetSpawnMode();
+  const emp::vector<emp::Point> & patches = r_manager.GetPatches();
+  emp::Point center;
+  bool near = false;
+
+  if(mode == ResourceManager::SpawnMode::PATCHES && patches.size())
+  {
+    center = patches[random.GetUInt(patches.size())];
+    near = true;
+  }
+  else if(mode == ResourceManager::SpawnMode::CLUSTERS)
+  {
+    // Next to a resource already on the surface, so clusters grow where resources are.
+    const size_t mid = random.GetUInt(config.NUMBER_RESOURCES());
+    if(r_manager.Alive(mid))
+    {
+      const SpatialGrid::Body & body = grid.GetBody(r_manager.GetSurfaceID(mid));
+      center = emp::Point(body.x, body.y);
+      near = true;
+    }
+  }
+
+  // Uniform (or nothing to spawn near)
+  if(!near)
+  {
+    const double x = random.GetDouble(config.WORLD_X());
+    return emp::Point(x, random.GetDouble(config.WORLD_Y()));
+  }
+  const double dx = random.GetRandNormal(0.0, config.RESOURCE_PATCH_SIGMA());
+  return grid.WrapPoint(center + emp::Point(dx, random.GetRandNormal(0.0, config.RESOURCE_PATCH_SIGMA())));
+}
+
+void BeakerWorld::RespawnResources() ///< Expire and respawn the resources due this update
+{
+  // Only resources due now are looked at (see ResourceManager).
+  res_expired.clear();
+  res_respawn.clear();
+  r_manager.Advance(GetUpdate(), res_expired, res_respawn);
+  for(size_t mid : res_expired) { grid.Park(r_manager.GetSurfaceID(mid)); }
+  if(res_respawn.empty()) { return; }
+
+  // Pick every spot first (clusters only grow around resources that were already there), then place them in one pass.
+  res_points.clear();
+  for(size_t mid : res_respawn)
+  {
+    CounterRandom random = RandomFor(Stream::RESPAWN, mid);
+    res_points.push_back(ResSpawnPoint(random));
+  }
+  for(size_t i = 0; i < res_respawn.size(); ++i)
+  {
+    grid.Place(r_manager.GetSurfaceID(res_respawn[i]), res_points[i]);
+    r_manager.Spawn(res_respawn[i], GetUpdate());
+  }
+  redraw = true;
+}
+
+void BeakerWorld::FindOverlap(BeakerOrg & org) ///< Trigger overlaps of org using the grid
+{
+  // Only the bodies in the neighbouring cells are checked.
+  grid.ForEachOverlap(org.GetSurfaceID(), [this, &org](size_t sid)
+  {
+    const SpatialGrid::Body & body = grid.GetBody(sid);
+    if(body.kind == SpatialGrid::Kind::ORG) { OrgOverlap(org, *pop[body.owner]); }
+    else { ResOverlap(org, r_manager.GetRes(body.owner)); }
+  });
+}
+
+const BeakerWorld::Percept & BeakerWorld::Perceive(size_t wid) ///< Sense the surroundings of an org (once per update)
+{
+  // Bodies only move when intents are applied, so every brain reads the same surface and an org's
+  // percept holds for the rest of the update.
+  Percept & percept = percepts[wid];
+  if(percept.stamp == cur_stamp) { return percept; }
+  percept.stamp = cur_stamp;
+
+  const emp::Point center = orgs.GetCenter(wid);
+  const double radius = orgs.GetRadius(wid);
+  const size_t self = pop[wid]->GetSurfaceID();
+  const double range = config.SENSE_RANGE();
+
+  // Nearest body of each kind (ring search out from the org's cell, stopping once nothing closer can remain).
+  auto sense = [&](auto && keep, double & dist, double & bearing)
+  {
+    double d2;
+    const size_t sid = grid.Nearest(center, range, keep, d2);
+    dist = (sid == SpatialGrid::NONE) ? -1.0 : std::sqrt(d2);
+    bearing = (sid == SpatialGrid::NONE) ? 0.0 : Bearing(wid, grid.Offset(center, grid.GetBody(sid)));
+  };
+  auto is_org = [&](size_t sid) { return sid != self && grid.GetBody(sid).kind == SpatialGrid::Kind::ORG; };
+  sense([&](size_t sid) { return is_org(sid) && grid.GetBody(sid).radius > radius; }, percept.larger_dist, percept.larger_bearing);
+  sense([&](size_t sid) { return is_org(sid) && grid.GetBody(sid).radius < radius; }, percept.smaller_dist, percept.smaller_bearing);
+
+  // A field has no bodies: sense the food under the org instead.
+  if(UseField()) { percept.res_dist = field.GetAt(center); percept.res_bearing = 0.0; }
+  else { sense([&](size_t sid) { return grid.GetBody(sid).kind == SpatialGrid::Kind::RES; }, percept.res_dist, percept.res_bearing); }
+
+  size_t count = 0;
+  grid.ForEachInRadius(center, range, [&](size_t sid, double) { if(is_org(sid)) { count++; } });
+  percept.density = count;
+  return percept;
+}
+
+double BeakerWorld::Bearing(size_t wid, const emp::Point & offset) const ///< Degrees from an org's heading to an offset
+{
+  // Signed angle from the heading vector to the offset, in (-180, 180].
+  const emp::Point heading = orgs.GetFacing(wid).GetPoint(1.0);
+  const double cross = heading.GetX() * offset.GetY() - heading.GetY() * offset.GetX();
+  const double dot = heading.GetX() * offset.GetX() + heading.GetY() * offset.GetY();
+  return std::atan2(cross, dot) * 180.0 / M_PI;
+}
+
+bool BeakerWorld::Latch(size_t wid, Signal sig, bool on) ///< Track a level; true when it just turned on
+{
+  const uint8_t bit = 1 << (NUM_SIGNALS + (size_t) sig);
+  const bool was_on = signals[wid] & bit;
+  signals[wid] = on ? (signals[wid] | bit) : (signals[wid] & ~bit);
+  return on && !was_on;
+}
+
+void BeakerWorld::DeliverSignals(size_t wid) ///< Start cores in an org's brain for its pending signals
+{
+  // Runs on the org's own thread before its brain: it only reads the surface and writes its own entry.
+  if(!config.SIGNALS()) { return; }
+  if(config.SIGNAL_ENERGY_LOW() > 0.0 && Latch(wid, Signal::ENERGY_LOW, orgs.GetEnergy(wid) < config.SIGNAL_ENERGY_LOW())) { Raise(wid, Signal::ENERGY_LOW); }
+  if(config.SIGNAL_RES_RANGE() > 0.0)
+  {
+    const emp::Point center = orgs.GetCenter(wid);
+    bool near;
+    if(UseField()) { near = field.GetAt(center) >= field.GetCapacity() / 2.0; }
+    else
+    {
+      double d2;
+      near = grid.Nearest(center, config.SIGNAL_RES_RANGE(), [this](size_t sid) { return grid.GetBody(sid).kind == SpatialGrid::Kind::RES; }, d2) != SpatialGrid::NONE;
+    }
+    if(Latch(wid, Signal::RES_NEAR, near)) { Raise(wid, Signal::RES_NEAR); }
+  }
+
+  const uint8_t pending = signals[wid] & ((1 << NUM_SIGNALS) - 1);
+  if(pending == 0) { return; }
+  hardware_t & hw = pop[wid]->GetBrain();
+  for(size_t sig = 0; sig < NUM_SIGNALS; ++sig)
+  {
+    // Same as queueing the event (the brain would handle it first thing), minus the queue.
+    if(pending & (1 << sig)) { hw.HandleEvent(signal_events[sig]); }
+  }
+  signals[wid] &= ~pending;
+}
+
+void BeakerWorld::ApplyIntents(BeakerOrg & org) ///< Apply actions recorded by an orgs brain
+{
+  bool moved = false;
+  for(const BeakerOrg::Intent & intent : org.GetIntents())
+  {
+    if(intent.type == BeakerOrg::Intent::Type::MOVE)
+    {
+      const emp::Point center = grid.WrapPoint(orgs.GetCenter(org.GetWorldID()) + intent.shift);
+      orgs.SetCenter(org.GetWorldID(), center);
+      grid.Move(org.GetSurfaceID(), center);
+      moved = true;
+    }
+    else
+    {
+      FindOverlap(org);  // Overlap functions automatically try to eat on overlap!
+      if(UseField()) { FieldConsume(org); }
+    }
+  }
+  org.ClearIntents();
+
+  // Bumping into an org is felt by both, once per update however many steps were taken.
+  if(moved && config.SIGNALS())
+  {
+    grid.ForEachOverlap(org.GetSurfaceID(), [this, &org](size_t sid)
+    {
+      const SpatialGrid::Body & body = grid.GetBody(sid);
+      if(body.kind != SpatialGrid::Kind::ORG) { return; }
+      Raise(org.GetWorldID(), Signal::COLLIDED);
+      Raise(body.owner, Signal::COLLIDED);
+    });
+  }
+}
+
+void BeakerWorld::Feed(size_t wid, double e, WorldStats::Food food) ///< Give an org energy (up to the cap) and record the intake
+{
+  const double old_e = orgs.GetEnergy(wid);
+  orgs.AddEnergy(wid, e, config.MAX_ENERGY_CAP());
+  stats.Feed(orgs.GetHeat(wid), orgs.GetRadius(wid), old_e, orgs.GetEnergy(wid), food);
 }
 
 void BeakerWorld::ProcessEvents() ///< Process all the events in order!
@@ -579,33 +1045,38 @@ void BeakerWorld::ProcessEvents() ///< Process all the events in order!
     // If consume resource event
     else if(event == (size_t) Trait::CONSUME)
     {
-      size_t org_wid = eaten_list[id];
+      size_t org_wid = eaten_by[id];
 
-      if(eater_list.find(org_wid) != eater_list.end())
+      if(Listed(eater_list, org_wid))
       {
-        auto & org = *pop[eaten_list[id]];
-        org.AddEnergy(config.RESOURCE_POWERUP(), config.MAX_ENERGY_CAP());
-        double x = random_ptr->GetDouble(config.WORLD_X());
-        double y = random_ptr->GetDouble(config.WORLD_Y());
-        surface.SetCenter(r_manager.GetSurfaceID(id), {x,y});
-        eater_list.erase(org_wid);
-        eaten_list.erase(id);
+        Feed(org_wid, config.RESOURCE_POWERUP(), WorldStats::Food::RESOURCE);
+        // Off the surface until RespawnResources puts it back.
+        grid.Park(r_manager.GetSurfaceID(id));
+        r_manager.Consumed(id, GetUpdate());
+        stats.CountResEaten();
+        Unlist(eater_list, org_wid);
+        Unlist(eaten_list, id);
       }
     }
     // If birth event
     else if(event == (size_t) Trait::BIRTH)
     {
-        // Check if we can add new org to pop.
-        if(GetNumOrgs() < config.MAX_POP_SIZE())
+        // Check if we can add new org to pop (counting offspring still waiting to be placed).
+        if(GetNumOrgs() + pending.size() < config.MAX_POP_SIZE())
         {
             // If org is still in the birth_list
-            if(birth_list.find(id) != birth_list.end())
+            if(Listed(birth_list, id))
             {
-                // Split energy for building offspring by half and spawn new organism.
-                auto & org = GetOrg(id);
-                org.SubEnergy(org.GetEnergy() / config.REPRODUCTION_PENALTY());
-                DoBirth(GetOrg(id), GetOrg(id).GetWorldID());
-                birth_list.erase(org.GetTrait((size_t)BeakerOrg::Trait::WRL_ID));
+                // Split energy for building offspring by half; the offspring is built when it is placed.
+                const double old_e = orgs.GetEnergy(id);
+                orgs.SubEnergy(id, old_e / config.REPRODUCTION_PENALTY());
+                stats.ChangeEnergy(orgs.GetRadius(id), old_e, orgs.GetEnergy(id));
+                pending.push_back({id, next_id + pending.size(), {orgs.GetCenter(id), orgs.GetRadius(id), orgs.GetFacing(id), 0},
+                                   GetOrg(id).GetGenomeID(), GetOrg(id).GetTaxonID()});
+                // The offspring shares its parent's genome and taxon, which must outlive the parent until placement.
+                genomes.AddRef(GetOrg(id).GetGenomeID());
+                phylo.AddRef(GetOrg(id).GetTaxonID());
+                Unlist(birth_list, id);
             }
         }
     }
@@ -617,133 +1088,101 @@ void BeakerWorld::ProcessEvents() ///< Process all the events in order!
     }
     events.pop();
   }
-
-  // Clear list for next update call
-  birth_list.clear();
-  kill_list.clear();
-  eater_list.clear();
-  eaten_list.clear();
+  // Lists expire on their own once cur_stamp moves on.
+  ProcessBirths();
 }
 
-size_t BeakerWorld::Calc_Heat(double r) ///< Function dedicated to injection the initial population or organisms and resources
+void BeakerWorld::ProcessBirths() ///< Mutate this update's offspring in parallel, then place them
 {
-  double diff = config.MAX_RAD_VAL() - config.MIN_RAD_VAL();
-  diff = diff / (double) hm_size;
-  size_t pos = 0;
-  double curr = config.MIN_RAD_VAL();
+  if(pending.empty()) { return; }
+
+  // Every offspring only uses its own streams, so the result does not depend on the number of threads.
+  // Each thread takes a contiguous run of births and mutates them in its own scratch program.
+  const size_t runs = scratch.size();
+  worker_pool.ParallelFor(runs, [this, runs](size_t t)
+  {
+    const size_t n = pending.size();
+    for(size_t i = t * n / runs; i < (t + 1) * n / runs; ++i) { MutateBirth(pending[i], scratch[t]); }
+  });
 
-  while(curr <= config.MAX_RAD_VAL())
+  // Place in event order so world ids and map ids come out as if births were done one at a time.
+  for(PendingBirth & b : pending)
   {
-    curr += diff;
-    if(r <= curr )
+    emp_assert(b.id == (size_t) next_id, b.id, next_id);
+
+    // Copy on write: only a changed program gets (or finds) its own entry, and starts a new taxon.
+    size_t gid = b.genome_id;
+    size_t taxon = b.taxon_id;
+    if(b.mutated)
     {
-      return pos;
+      gid = genomes.Intern(b.genome);
+      if(gid != b.genome_id) { taxon = phylo.AddTaxon(b.taxon_id, b.genome.Hash(), GetUpdate()); }
     }
-    pos++;
+
+    // The one copy of the program: decoded straight into the offspring's (recycled) brain.
+    emp::Ptr<BeakerOrg> org = emp::NewPtr<BeakerOrg>(&brain_pool);
+    genomes.Get(gid).Decode(org->GetBrain());
+    org->SetGenomeID(gid);
+    org->SetTaxonID(taxon);
+    birth = b.state;
+    PlaceOffspring(org, b.parent);
+    genomes.Release(b.genome_id);     // Placement took the offspring's own references
+    phylo.Release(b.taxon_id);
   }
-  return hm_size - 1;
+  pending.clear();
 }
 
-void BeakerWorld::Col_Birth(size_t h)  ///< Will increment number of heat signatures
+void BeakerWorld::PlaceOffspring(emp::Ptr<BeakerOrg> org, size_t parent) ///< Put a new offspring on the surface and in pop
 {
-  switch(h)
-  {
-  case 0:
-    blue_cnt++;
-    return;
+  // The brain is clean (recycled) and already holds the program, so start it up.
+  org->GetBrain().SpawnCore(0, memory_t(), true);
 
-  case 1:
-    cyan_cnt++;
-    return;
-  
-  case 2:
-    lime_cnt++;
-    return;
-  
-  case 3:
-    yellow_cnt++;
-    return;
-  
-  case 4:
-    red_cnt++;
-    return;
-  
-  case 5:
-    white_cnt++;
-    return;
-  }
-  std::cout << "Col_Birth Not Found: " << h << std::endl;
+  // birth holds where the offspring goes (the parent may be gone by now).  Add to the surface and set its
+  // surface id!  The org table is filled in on placement.
+  size_t surf_id = grid.AddBody(SpatialGrid::Kind::ORG, (size_t) -1, birth.center, birth.radius);
+  org->SetSurfaceID(surf_id);
+  org->SetTrait((size_t)BeakerOrg::Trait::HEAT_ID, birth.heat);
+  birth_ready = true;
+
+  // The offspring joins the statistics when it is put on the table.
+  stats.CountBirth();
+
+  AddOrgAt(org, emp::WorldPosition(TakeWorldID()), emp::WorldPosition(parent));
 }
 
-void BeakerWorld::Col_Death(size_t h)  ///< Will decrement number of heat signatures
+size_t BeakerWorld::TakeWorldID() ///< World id for a new org (a dead org's slot if there is one)
 {
-  switch(h)
-  {
-  case 0:
-    blue_cnt--;
-    return;
-
-  case 1:
-    cyan_cnt--;
-    return;
-  
-  case 2:
-    lime_cnt--;
-    return;
-  
-  case 3:
-    yellow_cnt--;
-    return;
-  
-  case 4:
-    red_cnt--;
-    return;
-  
-  case 5:
-    white_cnt--;
-    return;
-  }
-  std::cout << "Col_Death Not Found: " << h << std::endl;
+  // Only when no slot is free does the population grow at the end of pop.
+  if(free_wids.empty()) { return pop.size(); }
+  const size_t wid = free_wids.back();
+  free_wids.pop_back();
+  emp_assert(wid < pop.size() && pop[wid].IsNull(), wid);
+  return wid;
 }
 
-void BeakerWorld::Sum_Rad(size_t h, double radius)  ///< Will calculate average radius per heat signature
+void BeakerWorld::MutateBirth(PendingBirth & b, program_t & program) ///< Mutate one offspring (in program) using only its own streams
 {
-  switch(h)
+  if(!config.TESTING())
   {
-    case 0:
-      avg_blue += radius;
-      return;
-
-    case 1:
-      avg_cyan += radius;
-      return;
-    
-    case 2:
-      avg_lime += radius;
-      return;
-    
-    case 3:
-      avg_yellow += radius;
-      return;
-    
-    case 4:
-      avg_red += radius;
-      return;
-    
-    case 5:
-      avg_white += radius;
-      return;
+    CounterRandom rad_random = RandomFor(Stream::RADIUS, b.id);
+    b.state.radius = MutRad(b.state.radius, rad_random);
+    // The table is only read here.  Encoding (hashing waits for the serial part) is skipped when nothing changed.
+    genomes.Get(b.genome_id).DecodeProgram(program);
+    b.mutated = MutateProgram(program, b.id) > 0;
+    if(b.mutated) { b.genome.Encode(program); }
   }
+  b.state.heat = Calc_Heat(b.state.radius);
+}
+
+size_t BeakerWorld::Calc_Heat(double r) ///< Function will calculate an orgs heat signature
+{
+  return stats.Bin(r);
 }
 
-void BeakerWorld::Calc_Rad()  ///< Divide each sum of radii by the color count
+int BeakerWorld::BrainSeed(size_t id) ///< Function will calculate the seed of an orgs brain
 {
-  (blue_cnt == 0.0) ? avg_blue = 0.0 : avg_blue /= blue_cnt;
-  (cyan_cnt == 0.0) ? avg_cyan = 0.0 : avg_cyan /= cyan_cnt;
-  (lime_cnt == 0.0) ? avg_lime = 0.0 : avg_lime /= lime_cnt;
-  (yellow_cnt == 0.0) ? avg_yellow = 0.0 : avg_yellow /= yellow_cnt;
-  (red_cnt == 0.0) ? avg_red = 0.0 : avg_red /= red_cnt;
-  (white_cnt == 0.0) ? avg_white = 0.0 : avg_white /= white_cnt;
+  // Keyed by the org id alone, so a brain gets the same generator whatever update or thread it starts on.
+  return RandomFor(Stream::BRAIN, id, 0).GetSeed();
 }
 
 std::string BeakerWorld::Precision(double radius)  ///< Will set double to 3 precision
@@ -756,15 +1195,76 @@ std::string BeakerWorld::Precision(double radius)  ///< Will set double to 3 pre
   return pre;
 }
 
+void BeakerWorld::PrintSummary(std::ostream & os)  ///< Will print a one line summary of the world
+{
+  const HeatHistogram & heat_hist = stats.GetHeatHist();
+  os << "update=" << GetUpdate()
+     << " pop=" << GetNumOrgs()
+     << " next_id=" << next_id
+     << " stv=" << stats.GetStv()
+     << " eat=" << stats.GetEat()
+     << " apop=" << stats.GetPop()
+     << " rad=" << Precision(stats.GetRadiusMean())
+     << " energy=" << Precision(stats.GetEnergyMean())
+     << " genotypes=" << genomes.GetNumGenotypes()
+     << " taxa=" << phylo.GetNumTaxa()
+     << " mrca_depth=" << phylo.GetMRCADepth()
+     << " heat=[";
+  for(size_t h = 0; h < heat_hist.GetNumBins(); ++h) { os << (h ? "," : "") << heat_hist.GetCount(h); }
+  os << "]" << std::endl;
+}
+
+emp::vector<std::string> BeakerWorld::StatsColumns() const  ///< Names of the columns RecordStats writes
+{
+  const size_t bins = stats.GetHeatHist().GetNumBins();
+  emp::vector<std::string> cols = {"update"};
+  for(const char * name : {"pop_", "radius_", "res_intake_", "org_intake_"})
+  {
+    for(size_t h = 0; h < bins; ++h) { cols.push_back(name + std::to_string(h)); }
+  }
+  for(const char * name : {"radius_mean", "radius_var", "energy_mean", "energy_var", "births_update", "deaths_update",
+                           "births", "death_stv", "death_eat", "death_pop", "res_eaten", "genotypes", "taxa", "mrca_depth", "res_alive"}) { cols.push_back(name); }
+  return cols;
+}
+
+void BeakerWorld::RecordStats()  ///< Will append one row of statistics to the stats file
+{
+  if(stats_rec.IsNull()) { return; }
+
+  // Nothing is scanned here; the snapshot only copies the running totals.
+  stats.Fill(stats_snap);
+  const WorldStats::Snapshot & snap = stats_snap;
+
+  stats_row.clear();
+  stats_row.push_back(GetUpdate());
+  for(int v : snap.heat_count) { stats_row.push_back(v); }
+  for(double v : snap.heat_radius) { stats_row.push_back(v); }
+  for(double v : snap.res_intake) { stats_row.push_back(v); }
+  for(double v : snap.org_intake) { stats_row.push_back(v); }
+  for(double v : {snap.radius_mean, snap.radius_var, snap.energy_mean, snap.energy_var, (double) snap.births,
+                  (double) snap.deaths, (double) snap.total_births, (double) snap.death_stv, (double) snap.death_eat,
+                  (double) snap.death_pop, (double) snap.res_eaten, (double) genomes.GetNumGenotypes(),
+                  (double) phylo.GetNumTaxa(), (double) phylo.GetMRCADepth(), (double) r_manager.GetNumAlive()}) { stats_row.push_back(v); }
+  stats_rec->AddRow(stats_row);
+}
+
+void BeakerWorld::RecordPhylogeny()  ///< Will append a snapshot of the phylogeny to the phylogeny file
+{
+  if(!phylo_file.is_open()) { return; }
+
+  // Only taxa with living descendants are left, so a snapshot is about as long as the population.
+  phylo.Write(phylo_file, GetUpdate());
+  phylo_file.flush();
+}
+
 /* Functions dedicated to experiment functionality */
 
-double BeakerWorld::MutRad(double r, BeakerOrg & org)  ///< Function will mutate radius, if possible
+double BeakerWorld::MutRad(double r, CounterRandom & random)  ///< Function will mutate radius, if possible
 {
-  if(random_ptr->P(config.RADIUS_MUT()))
+  if(random.P(config.RADIUS_MUT()))
     {
-      double radius = surface.GetRadius(org.GetSurfaceID());
-      double diff = random_ptr->GetRandNormal(0, .3);
-      double new_r = radius + diff;
+      double diff = random.GetRandNormal(0, .3);
+      double new_r = r + diff;
 
       if(new_r > config.MAX_RAD_VAL())
       {
@@ -775,84 +1275,230 @@ double BeakerWorld::MutRad(double r, BeakerOrg & org)  ///< Function will mutate
         new_r = config.MIN_RAD_VAL();
       }
 
-      std::cerr << "(" << r << ")RADMUT(" << new_r << ")" << std::endl; 
-
       return new_r;
     }
     return r;
 }
 
-void BeakerWorld::InjectApex() ///< Will inject a preditor to the world...
+size_t BeakerWorld::MutateProgram(program_t & program, size_t id)  ///< Mutate the program of the org that gets map id, return mutation count
+{
+  // The mutator wants an emp::Random, so seed one from this org's stream.
+  emp::Random random(RandomFor(Stream::MUTATE, id).GetSeed());
+  return signalgp_mutator.ApplyMutations(program, random);
+}
+
+size_t BeakerWorld::InjectOrg(const BeakerOrg & org, double rad) ///< Inject a copy of org at a random spot, return its world id
+{
+  // Injected orgs take a dead org's slot, like offspring.
+  const size_t wid = TakeWorldID();
+  InjectAt(org, emp::WorldPosition(wid));
+  emp_assert(wid < pop.size() && pop[wid], wid);
+
+  // Random coordiantes for organism
+  CounterRandom random = RandomFor(Stream::ORG_PLACE, GetOrg(wid).GetMapID());
+  double x = random.GetDouble(config.WORLD_X());
+  double y = random.GetDouble(config.WORLD_Y());
+
+  // Calculate heat color
+  size_t heat = Calc_Heat(rad);
+
+  // Add organism to the surface and store its id
+  size_t surf_id = grid.AddBody(SpatialGrid::Kind::ORG, wid, {x,y}, rad);
+  GetOrg(wid).SetSurfaceID(surf_id);
+  orgs.Add(wid, {x,y}, rad, orgs.GetFacing(wid), config.INIT_ENERGY(), heat);
+  stats.AddOrg(heat, rad, config.INIT_ENERGY());
+
+  return wid;
+}
+
+void BeakerWorld::PushPattern(PackedGenome & genome, const emp::vector<std::string> & names, size_t times) ///< Push names times over
+{
+  emp::vector<size_t> ops;
+  for(const std::string & name : names) { ops.push_back(inst_lib.GetID(name)); }
+  for(size_t t = 0; t < times; ++t) { for(size_t op : ops) { genome.PushInst(op); } }
+}
+
+void BeakerWorld::BuildStart(PackedGenome & genome) ///< Will build the initial population's genome
 {
-  // std::cerr << "INJECTING-APEX" << std::endl;
-  double rad = 7.00000;
-  BeakerOrg org(inst_lib, event_lib, random_ptr);
-  org.GetBrain().SpawnCore(0, memory_t(), true);
-  org.SetRadius(rad);
-  Inject(org, 1);
-  size_t org_p = -1;
+  genome.Clear();
+  genome.PushFunction();
+  PushPattern(genome, {"Vroom", "Consume", "Vroom", "Vroom", "Consume", "Vroom", "Vroom"}, 21);
+  PushPattern(genome, {"SpinRight"}, 2);
+}
 
-  for(size_t i = 0; i < pop.size(); ++i)
+void BeakerWorld::BuildApex(PackedGenome & genome) ///< Will load the preditor genome (file or default)
+{
+  if(config.PRED_GENOME() != "")
   {
-    if(pop[i]->GetRadius() == 7.0)
+    std::ifstream file(config.PRED_GENOME());
+    if(!file.is_open())
     {
-      org_p = i;
-      break;
+      std::cerr << "ERROR: Could not open predator genome " << config.PRED_GENOME() << std::endl;
+      exit(-1);
     }
+    BeakerOrg org(&brain_pool);
+    org.Load(file);
+    genome.Encode(org.GetBrain().GetProgram());
+    return;
   }
 
-  emp_assert(org_p != -1, org_p);
-  BeakerOrg & orgg = GetOrg(org_p);
+  // Add instructions
+  genome.Clear();
+  genome.PushFunction();
+  PushPattern(genome, {"Vroom", "Consume", "Vroom", "Vroom", "Consume", "Vroom", "Vroom"}, 21);
+  PushPattern(genome, {"SpinLeft"}, 10);
+}
 
+void BeakerWorld::InjectApex(size_t num) ///< Will inject num preditors to the world...
+{
+  // The genome is built once; every predator copies its program and they share one new root taxon.
+  if(num == 0) { return; }
+  if(apex_genome.GetSize() == 0) { BuildApex(apex_genome); }
+  BeakerOrg apex(&brain_pool);
+  apex_genome.Decode(apex.GetBrain());
+  apex.SetGenomeID(genomes.Intern(apex_genome));
+  apex.SetTaxonID(phylo.AddTaxon(Phylogeny::NONE, apex_genome.Hash(), GetUpdate()));
+
+  for(size_t i = 0; i < num; ++i)
+  {
+    const size_t wid = InjectOrg(apex, config.PRED_RADIUS());
+    GetOrg(wid).GetBrain().SpawnCore(0, memory_t(), true);
+  }
+}
 
-  // Random coordiantes for organism
-  double x = random_ptr->GetDouble(config.WORLD_X());
-  double y = random_ptr->GetDouble(config.WORLD_Y());
+/* Functions dedicated to checkpoints */
 
-  // Get random radius and calculate heat color
-  size_t heat = Calc_Heat(rad);
-  Col_Birth(heat);
+bool BeakerWorld::SaveCheckpoint(const std::string & path) ///< Write the whole run state between updates
+{
+  static_assert(TAG_WIDTH <= 16, "Packed genomes hold 16-bit tags");
+  CheckpointWriter out(path);
+  if(!out.Good()) { return false; }
+
+  // Rows recorded up to now must survive a crash, since a resumed run carries on after them.
+  if(stats_rec) { stats_rec->Flush(); }
+  if(phylo_file.is_open()) { phylo_file.flush(); }
+
+  out.Write(CHECKPOINT_MAGIC);
+  out.Write(CHECKPOINT_VERSION);
+
+  // World counters and statistics
+  out.Write<uint64_t>(GetUpdate());
+  out.Write<uint64_t>(pop.size());
+  out.WriteVector(free_wids);
+  out.Write(next_id);
+  stats.Save(out);
+  out.Write<uint8_t>(pred_inject);
+  out.WriteRaw(*random_ptr);
+
+  // Each genotype is written once; organisms refer to it by genome id.
+  genomes.Save(out);
+  phylo.Save(out);
+
+  // Every organism: ids, genome id, taxon id, signals and hardware state
+  out.Write<uint64_t>(GetNumOrgs());
+  for(size_t wid = 0; wid < pop.size(); ++wid)
+  {
+    if(pop[wid].IsNull()) { continue; }
+    BeakerOrg & org = *pop[wid];
+    out.Write<uint64_t>(wid);
+    out.Write<uint64_t>(org.GetMapID());
+    out.Write<uint64_t>(org.GetSurfaceID());
+    out.Write<uint64_t>(org.GetGenomeID());
+    out.Write<uint64_t>(org.GetTaxonID());
+    out.Write<uint8_t>(signals[wid]);
+    checkpoint::WriteHardware(out, org.GetBrain());
+  }
 
-  // Add instructions
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom"); orgg.PushInst("Consume"); orgg.PushInst("Vroom"); orgg.PushInst("Vroom");
-  orgg.PushInst("SpinLeft"); orgg.PushInst("SpinLeft");orgg.PushInst("SpinLeft"); orgg.PushInst("SpinLeft");orgg.PushInst("SpinLeft"); orgg.PushInst("SpinLeft");orgg.PushInst("SpinLeft"); 
-  orgg.PushInst("SpinLeft"); orgg.PushInst("SpinLeft"); orgg.PushInst("SpinLeft");
-  orgg.SetEnergy(config.INIT_ENERGY());
+  // Physics: the org table, surface and resources
+  orgs.Save(out);
+  grid.Save(out);
+  r_manager.Save(out);
+  field.Save(out);
 
-  // Add organism to the surface and store its id
-  size_t surf_id = surface.AddBody(&orgg, {x,y}, rad, heat);
-  // std::cerr << "\n##################################################" << std::endl;
-  // std::cerr << "SURFID=" << surf_id << std::endl;
-
-  orgg.SetSurfaceID(surf_id);
-  orgg.SetHeatID(heat);
-  Sum_Rad(heat, surface.GetRadius(orgg.GetSurfaceID()));
-
-  // std::cerr << "BEFORE-INJECT" << std::endl;
-  // std::cerr << "AFTER-INJECT\n" << std::endl;
-  // std::cerr << "ORG_SURFID=" << orgg.GetSurfaceID() << std::endl;
-  // std::cerr << "ORG_WRLLID=" << orgg.GetWorldID() << std::endl;  
-  // std::cerr << "ORG_MAPPID=" << orgg.GetMapID() << std::endl;
+  return out.Good();
+}
+
+void BeakerWorld::LoadCheckpoint(const std::string & path) ///< Bring a run back to a saved update
+{
+  CheckpointReader in(path);
+  if(!in.Good() || in.Read<uint32_t>() != CHECKPOINT_MAGIC || in.Read<uint32_t>() != CHECKPOINT_VERSION)
+  {
+    std::cerr << "ERROR: " << path << " is not a BeakerWorld checkpoint" << std::endl;
+    exit(-1);
+  }
+
+  // Start from an empty population.
+  Clear();
+  scheduler.clear();
+  events.clear();
+  birth_ready = false;
+
+  const size_t saved_update = in.Read<uint64_t>();
+  const size_t pop_size = in.Read<uint64_t>();
+  emp::vector<size_t> saved_free_wids;
+  in.ReadVector(saved_free_wids);
+  const int saved_next_id = in.Read<int>();
+  stats.Load(in);
+  pred_inject = in.Read<uint8_t>();
+  emp::Random saved_random(*random_ptr);
+  in.ReadRaw(saved_random);
+
+  // Placement adds the references back one org at a time.
+  genomes.Load(in);
+  genomes.ClearCounts();
+  phylo.Load(in);
+  phylo.ClearCounts();
+
+  // Put every org back in its old slot (empty slots stay empty, so new ids line up).
+  pop.resize(pop_size, nullptr);
+  const size_t num_orgs = in.Read<uint64_t>();
+  for(size_t i = 0; i < num_orgs; ++i)
+  {
+    const size_t wid = in.Read<uint64_t>();
+    const size_t map_id = in.Read<uint64_t>();
+    const size_t surf_id = in.Read<uint64_t>();
+    const size_t genome_id = in.Read<uint64_t>();
+    const size_t taxon_id = in.Read<uint64_t>();
+    const uint8_t org_signals = in.Read<uint8_t>();
+    if(!genomes.IsUsed(genome_id) || !phylo.IsUsed(taxon_id))
+    {
+      std::cerr << "ERROR: Checkpoint " << path << " refers to a missing genome or taxon" << std::endl;
+      exit(-1);
+    }
+
+    BeakerOrg org(&brain_pool);
+    genomes.Get(genome_id).Decode(org.GetBrain());
+    org.SetGenomeID(genome_id);
+    org.SetTaxonID(taxon_id);
+    InjectAt(org, emp::WorldPosition(wid));
+
+    // Placement hands out fresh ids, so put the saved ones back.
+    BeakerOrg & placed = GetOrg(wid);
+    placed.SetMapID(map_id);
+    placed.SetSurfaceID(surf_id);
+    signals[wid] = org_signals;
+    checkpoint::ReadHardware(in, placed.GetBrain());
+  }
+
+  genomes.Prune();
+
+  // Clearing freed every old slot, so only the saved free ids (in their order) are handed out next.
+  free_wids = saved_free_wids;
+
+  // Placement also touched the table and the generator, so these are restored last.
+  orgs.Load(in);
+  grid.Load(in);
+  r_manager.Load(in);
+  field.Load(in);
+  update = saved_update;
+  next_id = saved_next_id;
+  *random_ptr = saved_random;
+
+  if(!in.Good())
+  {
+    std::cerr << "ERROR: Checkpoint " << path << " is truncated" << std::endl;
+    exit(-1);
+  }
 }
 
 #endif
\ No newline at end of file
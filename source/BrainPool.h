@@ -0,0 +1,97 @@
+/// This is a free list of SignalGP hardware so dead organisms' brains can be recycled by offspring.
+
+#ifndef BRAIN_POOL_H
+#define BRAIN_POOL_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/Ptr.h"
+#include "base/assert.h"
+
+template <typename HARDWARE_T>
+class BrainPool
+{
+  public:
+
+    using hardware_t = HARDWARE_T;
+    using inst_lib_t = typename hardware_t::inst_lib_t;
+    using event_lib_t = typename hardware_t::event_lib_t;
+
+  private:
+
+    inst_lib_t & inst_lib;                      ///< Libraries every brain is built with
+    event_lib_t & event_lib;
+    emp::vector<emp::Ptr<hardware_t>> free;     ///< Brains waiting to be reused
+    size_t num_live = 0;                        ///< Brains currently handed out
+
+  public:
+
+    /* Constructors, Destructors */
+
+    BrainPool(inst_lib_t & _inst_lib, event_lib_t & _event_lib) : inst_lib(_inst_lib), event_lib(_event_lib) { ; }
+    ~BrainPool();
+
+    BrainPool(const BrainPool &) = delete;
+    BrainPool & operator=(const BrainPool &) = delete;
+
+
+    /* Getter functions */
+
+    size_t GetNumFree() const { return free.size(); }
+    size_t GetNumLive() const { return num_live; }
+
+
+    /* Functions dedicated to handing out brains */
+
+    emp::Ptr<hardware_t> Acquire();             ///< Get a brain with clean hardware state (program is left as is)
+    void Release(emp::Ptr<hardware_t> brain);   ///< Give a brain back to the pool
+    void Reserve(size_t count);                 ///< Build brains ahead of time
+};
+
+
+/* Constructors, Destructors */
+
+template <typename HARDWARE_T>
+BrainPool<HARDWARE_T>::~BrainPool()
+{
+  emp_assert(num_live == 0, num_live);
+  for(emp::Ptr<hardware_t> brain : free) { brain.Delete(); }
+  free.clear();
+}
+
+
+/* Functions dedicated to handing out brains */
+
+template <typename HARDWARE_T>
+emp::Ptr<HARDWARE_T> BrainPool<HARDWARE_T>::Acquire()
+{
+  ++num_live;
+  if(free.empty())
+  {
+    // No random pointer, so each brain owns its own generator.
+    return emp::NewPtr<hardware_t>(inst_lib, event_lib, nullptr);
+  }
+
+  emp::Ptr<hardware_t> brain = free.back();
+  free.pop_back();
+  brain->ResetHardware();
+  return brain;
+}
+
+template <typename HARDWARE_T>
+void BrainPool<HARDWARE_T>::Release(emp::Ptr<hardware_t> brain)
+{
+  emp_assert(brain);
+  emp_assert(num_live > 0, num_live);
+  --num_live;
+  free.push_back(brain);
+}
+
+template <typename HARDWARE_T>
+void BrainPool<HARDWARE_T>::Reserve(size_t count)
+{
+  free.reserve(count);
+  while(free.size() + num_live < count) { free.push_back(emp::NewPtr<hardware_t>(inst_lib, event_lib, nullptr)); }
+}
+
+#endif
@@ -0,0 +1,253 @@
+/// This is a small binary format for saving and restoring a BeakerWorld run.
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Standard C++ includes
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+class CheckpointWriter
+{
+  private:
+
+    std::ofstream os;           ///< Where the checkpoint is streamed to
+
+  public:
+
+    /* Constructors */
+
+    CheckpointWriter(const std::string & path) : os(path, std::ios::binary) { ; }
+
+
+    /* Getter functions */
+
+    bool Good() const { return os.good(); }
+
+
+    /* Functions dedicated to writing */
+
+    void WriteBytes(const void * data, size_t size) { os.write(static_cast<const char *>(data), size); }
+
+    ///< Plain values go out as raw bytes.
+    template <typename T>
+    void Write(const T & value)
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "Write only takes plain values");
+      WriteBytes(&value, sizeof(T));
+    }
+
+    ///< Objects that only hold plain data (e.g. emp::Random), copied out byte for byte.
+    template <typename T>
+    void WriteRaw(const T & object) { WriteBytes(&object, sizeof(T)); }
+
+    ///< A length followed by the raw elements.
+    template <typename T>
+    void WriteVector(const emp::vector<T> & vec)
+    {
+      Write<uint64_t>(vec.size());
+      if(vec.size()) { WriteBytes(vec.data(), sizeof(T) * vec.size()); }
+    }
+
+    ///< Any map of plain keys to plain values (e.g. SignalGP memory).
+    template <typename MAP_T>
+    void WriteMap(const MAP_T & map)
+    {
+      Write<uint64_t>(map.size());
+      for(const auto & entry : map) { Write(entry.first); Write(entry.second); }
+    }
+};
+
+class CheckpointReader
+{
+  private:
+
+    std::ifstream is;           ///< Where the checkpoint is streamed from
+
+  public:
+
+    /* Constructors */
+
+    CheckpointReader(const std::string & path) : is(path, std::ios::binary) { ; }
+
+
+    /* Getter functions */
+
+    bool Good() const { return is.good(); }
+
+
+    /* Functions dedicated to reading */
+
+    void ReadBytes(void * data, size_t size) { is.read(static_cast<char *>(data), size); }
+
+    template <typename T>
+    T Read()
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "Read only takes plain values");
+      T value;
+      ReadBytes(&value, sizeof(T));
+      return value;
+    }
+
+    template <typename T>
+    void ReadRaw(T & object) { ReadBytes(&object, sizeof(T)); }
+
+    template <typename T>
+    void ReadVector(emp::vector<T> & vec)
+    {
+      vec.resize(Read<uint64_t>());
+      if(vec.size()) { ReadBytes(vec.data(), sizeof(T) * vec.size()); }
+    }
+
+    template <typename MAP_T>
+    void ReadMap(MAP_T & map)
+    {
+      using key_t = typename MAP_T::key_type;
+      using value_t = typename MAP_T::mapped_type;
+      map.clear();
+      const uint64_t size = Read<uint64_t>();
+      for(uint64_t i = 0; i < size; ++i)
+      {
+        const key_t key = Read<key_t>();
+        map[key] = Read<value_t>();
+      }
+    }
+};
+
+
+/* SignalGP hardware */
+
+namespace checkpoint
+{
+  ///< Reaches the hardware state SignalGP keeps protected.  Taking the member pointers inside a
+  ///< derived class is allowed, and they can then be used on any hardware object.
+  template <typename HARDWARE_T>
+  struct HardwareAccess : public HARDWARE_T
+  {
+    static auto SharedMem() { return &HardwareAccess::shared_mem; }
+    static auto EventQueue() { return &HardwareAccess::event_queue; }
+    static auto Traits() { return &HardwareAccess::traits; }
+    static auto Errors() { return &HardwareAccess::errors; }
+    static auto Cores() { return &HardwareAccess::cores; }
+    static auto ActiveCores() { return &HardwareAccess::active_cores; }
+    static auto InactiveCores() { return &HardwareAccess::inactive_cores; }
+    static auto PendingCores() { return &HardwareAccess::pending_cores; }
+    static auto ExecCoreID() { return &HardwareAccess::exec_core_id; }
+    static auto IsExecuting() { return &HardwareAccess::is_executing; }
+  };
+
+  template <typename SEQ_T>
+  void WriteSeq(CheckpointWriter & out, const SEQ_T & seq)
+  {
+    out.Write<uint64_t>(seq.size());
+    for(const auto & v : seq) { out.Write(v); }
+  }
+
+  template <typename SEQ_T>
+  void ReadSeq(CheckpointReader & in, SEQ_T & seq)
+  {
+    using value_t = typename SEQ_T::value_type;
+    seq.clear();
+    const uint64_t size = in.Read<uint64_t>();
+    for(uint64_t i = 0; i < size; ++i) { seq.push_back(in.Read<value_t>()); }
+  }
+
+  template <typename HARDWARE_T>
+  void WriteHardware(CheckpointWriter & out, HARDWARE_T & hw)
+  {
+    using access_t = HardwareAccess<HARDWARE_T>;
+
+    // Checkpoints are taken between updates, when no events are waiting.
+    emp_assert((hw.*access_t::EventQueue()).empty());
+
+    out.WriteRaw(hw.GetRandom());
+    out.WriteMap(hw.*access_t::SharedMem());
+    out.WriteVector(hw.*access_t::Traits());
+    out.Write<uint64_t>(hw.*access_t::Errors());
+    out.Write<uint64_t>(hw.*access_t::ExecCoreID());
+    WriteSeq(out, hw.*access_t::ActiveCores());
+    WriteSeq(out, hw.*access_t::InactiveCores());
+    WriteSeq(out, hw.*access_t::PendingCores());
+
+    // Every core is a call stack of states.
+    const auto & cores = hw.*access_t::Cores();
+    out.Write<uint64_t>(cores.size());
+    for(const auto & stack : cores)
+    {
+      out.Write<uint64_t>(stack.size());
+      for(const auto & state : stack)
+      {
+        out.WriteMap(state.local_mem);
+        out.WriteMap(state.input_mem);
+        out.WriteMap(state.output_mem);
+        out.Write(state.default_mem_val);
+        out.Write<uint64_t>(state.func_ptr);
+        out.Write<uint64_t>(state.inst_ptr);
+        out.Write<uint8_t>(state.is_main);
+
+        // Open If/While/Countdown blocks, so Close, Break and loop-backs resume where they were.
+        out.Write<uint64_t>(state.block_stack.size());
+        for(const auto & block : state.block_stack)
+        {
+          out.Write<uint64_t>(block.begin);
+          out.Write<uint64_t>(block.end);
+          out.Write<uint8_t>((uint8_t) block.type);
+        }
+      }
+    }
+  }
+
+  template <typename HARDWARE_T>
+  void ReadHardware(CheckpointReader & in, HARDWARE_T & hw)
+  {
+    using access_t = HardwareAccess<HARDWARE_T>;
+    using state_t = typename HARDWARE_T::State;
+    using block_t = typename HARDWARE_T::Block;
+    using block_type_t = typename HARDWARE_T::BlockType;
+
+    in.ReadRaw(hw.GetRandom());
+    in.ReadMap(hw.*access_t::SharedMem());
+    in.ReadVector(hw.*access_t::Traits());
+    hw.*access_t::Errors() = in.Read<uint64_t>();
+    hw.*access_t::ExecCoreID() = in.Read<uint64_t>();
+    ReadSeq(in, hw.*access_t::ActiveCores());
+    ReadSeq(in, hw.*access_t::InactiveCores());
+    ReadSeq(in, hw.*access_t::PendingCores());
+
+    auto & cores = hw.*access_t::Cores();
+    cores.resize(in.Read<uint64_t>());
+    for(auto & stack : cores)
+    {
+      stack.resize(in.Read<uint64_t>());
+      for(state_t & state : stack)
+      {
+        in.ReadMap(state.local_mem);
+        in.ReadMap(state.input_mem);
+        in.ReadMap(state.output_mem);
+        state.default_mem_val = in.Read<double>();
+        state.func_ptr = in.Read<uint64_t>();
+        state.inst_ptr = in.Read<uint64_t>();
+        state.is_main = in.Read<uint8_t>();
+
+        state.block_stack.clear();
+        const uint64_t num_blocks = in.Read<uint64_t>();
+        for(uint64_t b = 0; b < num_blocks; ++b)
+        {
+          const size_t begin = in.Read<uint64_t>();
+          const size_t end = in.Read<uint64_t>();
+          state.block_stack.emplace_back(block_t(begin, end, (block_type_t) in.Read<uint8_t>()));
+        }
+      }
+    }
+  }
+}
+
+#endif
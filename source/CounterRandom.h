@@ -0,0 +1,118 @@
+/// This is a counter-based random number generator (Philox4x32-10), so every draw is a pure function of its key and counter.
+
+#ifndef COUNTER_RANDOM_H
+#define COUNTER_RANDOM_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Standard C++ includes
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+/// A stream is named by (seed, update, id, stream).  The seed and update form the Philox key; the
+/// stream, id and a draw index form the counter.  Two streams never share a block, and a stream can
+/// be rebuilt at any time from its name, so results do not depend on which thread asks or when.
+
+class CounterRandom
+{
+  public:
+
+    using block_t = std::array<uint32_t, 4>;
+    using key_t = std::array<uint32_t, 2>;
+
+  private:
+
+    key_t key;                          ///< (seed, update)
+    block_t ctr;                        ///< (draw index, stream, id low, id high)
+    block_t out;                        ///< Current block of output
+    size_t used = 4;                    ///< Words of out already handed out
+
+    static void MulHiLo(uint32_t a, uint32_t b, uint32_t & hi, uint32_t & lo)
+    {
+      const uint64_t p = (uint64_t) a * b;
+      hi = (uint32_t) (p >> 32);
+      lo = (uint32_t) p;
+    }
+
+  public:
+
+    /* Constructors */
+
+    CounterRandom(uint64_t seed, uint64_t update, uint64_t id, uint32_t stream=0)
+      : key{{(uint32_t) seed, (uint32_t) update}}, ctr{{0, stream, (uint32_t) id, (uint32_t) (id >> 32)}} { ; }
+
+
+    /* Functions dedicated to the generator */
+
+    static block_t Philox(block_t c, key_t k);    ///< Philox4x32 with 10 rounds
+
+
+    /* Functions dedicated to drawing values */
+
+    uint32_t GetUInt32()
+    {
+      if(used == 4) { out = Philox(ctr, key); ctr[0]++; used = 0; }
+      return out[used++];
+    }
+    uint64_t GetUInt64() { const uint64_t hi = GetUInt32(); return (hi << 32) | GetUInt32(); }
+
+    double GetDouble() { return (GetUInt64() >> 11) * 0x1.0p-53; }            ///< [0, 1)
+    double GetDouble(double max) { return GetDouble() * max; }                  ///< [0, max)
+    double GetDouble(double min, double max) { return min + GetDouble() * (max - min); }
+    size_t GetUInt(size_t max) { return (size_t) (GetDouble() * max); }         ///< [0, max)
+    bool P(double p) { return GetDouble() < p; }
+    double GetRandNormal(double mean=0.0, double std=1.0);                      ///< Box-Muller
+
+    ///< A seed for generators that are not counter based (e.g. emp::Random); always in [1, 2^31 - 1).
+    int GetSeed() { return (int) (GetUInt32() % 2147483646u) + 1; }
+};
+
+
+/* Functions dedicated to the generator */
+
+CounterRandom::block_t CounterRandom::Philox(block_t c, key_t k)
+{
+  constexpr uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;     ///< Round multipliers
+  constexpr uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;     ///< Key schedule (Weyl sequence)
+
+  for(size_t round = 0; round < 10; ++round)
+  {
+    uint32_t hi0, lo0, hi1, lo1;
+    MulHiLo(M0, c[0], hi0, lo0);
+    MulHiLo(M1, c[2], hi1, lo1);
+    c = {{hi1 ^ c[1] ^ k[0], lo1, hi0 ^ c[3] ^ k[1], lo0}};
+    k[0] += W0;
+    k[1] += W1;
+  }
+  return c;
+}
+
+
+/* Functions dedicated to drawing values */
+
+double CounterRandom::GetRandNormal(double mean, double std)
+{
+  const double u1 = 1.0 - GetDouble();                      ///< (0, 1], so the log is finite
+  const double u2 = GetDouble();
+  return mean + std * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+}
+
+
+/* Helpers */
+
+///< Fisher-Yates shuffle driven by a counter stream.
+template <typename T>
+void Shuffle(CounterRandom & random, emp::vector<T> & vec)
+{
+  for(size_t i = vec.size(); i > 1; --i)
+  {
+    const size_t j = random.GetUInt(i);
+    std::swap(vec[i - 1], vec[j]);
+  }
+}
+
+#endif
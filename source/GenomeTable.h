@@ -0,0 +1,188 @@
+/// This is a hash-consed, reference-counted table of genomes, so identical programs are stored once.
+
+#ifndef GENOME_TABLE_H
+#define GENOME_TABLE_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+#include "PackedGenome.h"
+
+///< Standard C++ includes
+#include <unordered_map>
+#include <cstdint>
+#include <utility>
+
+/// Genomes in the table never change.  A mutated offspring interns its new genome and lets go of its
+/// parent's (copy on write), so the number of live entries is the number of genotypes.  An entry is
+/// freed when its last reference goes; interning does not take a reference by itself.
+///
+/// A pending birth only holds a reference to its parent's entry, and gets a packed copy of its own only
+/// when mutations changed the program.  It is unpacked only into a reused scratch program to mutate it,
+/// and into its own brain once it is placed.  Known limit: every brain still holds its own unpacked
+/// program, since SignalGP hardware only runs a program it owns, so the sharing saves copies per birth
+/// and not per living organism.
+
+class GenomeTable
+{
+  public:
+
+    static constexpr size_t NONE = (size_t) -1;
+
+  private:
+
+    struct Entry
+    {
+      PackedGenome genome;
+      uint64_t hash = 0;
+      size_t count = 0;                 ///< Organisms (or pending offspring) holding this genome
+      bool used = false;                ///< Is this slot holding a genome?
+    };
+
+    emp::vector<Entry> entries;                         ///< Indexed by genome id
+    emp::vector<size_t> free_ids;                       ///< Slots to reuse
+    std::unordered_multimap<uint64_t, size_t> index;    ///< Hash -> genome id
+    size_t num_genotypes = 0;
+
+    void Free(size_t id);
+
+  public:
+
+    /* Getter functions */
+
+    size_t GetNumGenotypes() const { return num_genotypes; }
+    size_t GetCapacity() const { return entries.size(); }
+    bool IsUsed(size_t id) const { return id < entries.size() && entries[id].used; }
+    size_t GetCount(size_t id) const { emp_assert(IsUsed(id), id); return entries[id].count; }
+    const PackedGenome & Get(size_t id) const { emp_assert(IsUsed(id), id); return entries[id].genome; }
+    size_t GetDominant() const;                               ///< Most common genome (NONE if empty)
+
+
+    /* Functions dedicated to maintaining the table */
+
+    size_t Intern(const PackedGenome & genome);               ///< Id of an equal genome, added if new
+    void AddRef(size_t id) { emp_assert(IsUsed(id), id); entries[id].count++; }
+    void Release(size_t id);
+    void ClearCounts();                                       ///< Drop every reference (entries stay until released)
+    void Prune();                                             ///< Free entries nobody holds
+
+
+    /* Functions dedicated to checkpoints */
+
+    void Save(CheckpointWriter & out) const;
+    void Load(CheckpointReader & in);
+};
+
+
+/* Getter functions */
+
+size_t GenomeTable::GetDominant() const
+{
+  size_t best = NONE;
+  for(size_t id = 0; id < entries.size(); ++id)
+  {
+    if(entries[id].used && (best == NONE || entries[id].count > entries[best].count)) { best = id; }
+  }
+  return best;
+}
+
+
+/* Functions dedicated to maintaining the table */
+
+size_t GenomeTable::Intern(const PackedGenome & genome)
+{
+  const uint64_t hash = genome.Hash();
+  auto range = index.equal_range(hash);
+  for(auto it = range.first; it != range.second; ++it)
+  {
+    if(entries[it->second].genome == genome) { return it->second; }
+  }
+
+  size_t id;
+  if(free_ids.size()) { id = free_ids.back(); free_ids.pop_back(); }
+  else { id = entries.size(); entries.emplace_back(); }
+
+  Entry & entry = entries[id];
+  entry.genome = genome;
+  entry.hash = hash;
+  entry.count = 0;
+  entry.used = true;
+  index.emplace(hash, id);
+  num_genotypes++;
+  return id;
+}
+
+void GenomeTable::Release(size_t id)
+{
+  emp_assert(IsUsed(id) && entries[id].count > 0, id);
+  if(--entries[id].count == 0) { Free(id); }
+}
+
+void GenomeTable::Free(size_t id)
+{
+  Entry & entry = entries[id];
+  auto range = index.equal_range(entry.hash);
+  for(auto it = range.first; it != range.second; ++it)
+  {
+    if(it->second == id) { index.erase(it); break; }
+  }
+  entry.genome.Clear();
+  entry.used = false;
+  free_ids.push_back(id);
+  num_genotypes--;
+}
+
+void GenomeTable::ClearCounts()
+{
+  for(Entry & entry : entries) { entry.count = 0; }
+}
+
+void GenomeTable::Prune()
+{
+  for(size_t id = 0; id < entries.size(); ++id)
+  {
+    if(entries[id].used && entries[id].count == 0) { Free(id); }
+  }
+}
+
+
+/* Functions dedicated to checkpoints */
+
+void GenomeTable::Save(CheckpointWriter & out) const
+{
+  // Only live entries go out, with their ids, so organisms can keep theirs.
+  out.Write<uint64_t>(entries.size());
+  out.Write<uint64_t>(num_genotypes);
+  for(size_t id = 0; id < entries.size(); ++id)
+  {
+    if(!entries[id].used) { continue; }
+    out.Write<uint64_t>(id);
+    out.Write<uint64_t>(entries[id].count);
+    entries[id].genome.Save(out);
+  }
+}
+
+void GenomeTable::Load(CheckpointReader & in)
+{
+  entries.clear();
+  free_ids.clear();
+  index.clear();
+  entries.resize(in.Read<uint64_t>());
+  num_genotypes = in.Read<uint64_t>();
+  for(size_t i = 0; i < num_genotypes; ++i)
+  {
+    const size_t id = in.Read<uint64_t>();
+    Entry & entry = entries[id];
+    entry.count = in.Read<uint64_t>();
+    entry.genome.Load(in);
+    entry.hash = entry.genome.Hash();
+    entry.used = true;
+    index.emplace(entry.hash, id);
+  }
+  for(size_t id = entries.size(); id-- > 0; ) { if(!entries[id].used) { free_ids.push_back(id); } }
+}
+
+#endif
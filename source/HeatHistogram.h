@@ -0,0 +1,88 @@
+/// This is a histogram of organism radii over HM_SIZE equal-width heat bins, kept up to date on every birth and death.
+
+#ifndef HEAT_HISTOGRAM_H
+#define HEAT_HISTOGRAM_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+
+///< Standard C++ includes
+#include <cmath>
+#include <algorithm>
+
+class HeatHistogram
+{
+  private:
+
+    double min_r;                       ///< Lower edge of bin 0
+    double width;                       ///< Width of every bin
+    emp::vector<int> count;             ///< Number of orgs in each bin
+    emp::vector<double> sum;            ///< Sum of radii in each bin
+    emp::vector<double> sum_sq;         ///< Sum of squared radii in each bin
+
+  public:
+
+    /* Constructors */
+
+    HeatHistogram(size_t num_bins, double _min_r, double _max_r);
+
+
+    /* Functions dedicated to maintaining the histogram */
+
+    ///< Bin b holds radii in (min + b*width, min + (b+1)*width]; anything outside goes to the end bins.
+    size_t Bin(double r) const
+    {
+      if(r <= min_r) { return 0; }
+      const double b = std::ceil((r - min_r) / width) - 1.0;
+      return (b >= (double) count.size()) ? count.size() - 1 : (size_t) b;
+    }
+    void Add(size_t bin, double r) { emp_assert(bin < count.size(), bin); count[bin]++; sum[bin] += r; sum_sq[bin] += r * r; }
+    void Remove(size_t bin, double r) { emp_assert(bin < count.size(), bin); count[bin]--; sum[bin] -= r; sum_sq[bin] -= r * r; }
+    void Clear();
+
+
+    /* Getter functions */
+
+    size_t GetNumBins() const { return count.size(); }
+    int GetCount(size_t bin) const { return (bin < count.size()) ? count[bin] : 0; }
+    double GetMean(size_t bin) const { return (GetCount(bin) > 0) ? sum[bin] / count[bin] : 0.0; }
+    double GetVariance(size_t bin) const
+    {
+      if(GetCount(bin) <= 0) { return 0.0; }
+      const double mean = GetMean(bin);
+      return std::max(0.0, sum_sq[bin] / count[bin] - mean * mean);
+    }
+
+
+    /* Functions dedicated to checkpoints */
+
+    void Save(CheckpointWriter & out) const { out.WriteVector(count); out.WriteVector(sum); out.WriteVector(sum_sq); }
+    void Load(CheckpointReader & in) { in.ReadVector(count); in.ReadVector(sum); in.ReadVector(sum_sq); }
+};
+
+
+/* Constructors */
+
+HeatHistogram::HeatHistogram(size_t num_bins, double _min_r, double _max_r)
+  : min_r(_min_r), width((_max_r - _min_r) / (double) num_bins),
+    count(num_bins, 0), sum(num_bins, 0.0), sum_sq(num_bins, 0.0)
+{
+  emp_assert(num_bins > 0, num_bins);
+  emp_assert(width > 0.0, width);
+}
+
+
+/* Functions dedicated to maintaining the histogram */
+
+void HeatHistogram::Clear()
+{
+  std::fill(count.begin(), count.end(), 0);
+  std::fill(sum.begin(), sum.end(), 0.0);
+  std::fill(sum_sq.begin(), sum_sq.end(), 0.0);
+}
+
+#endif
@@ -0,0 +1,239 @@
+/// This is a structure-of-arrays store for the physical state of organisms, indexed by world id.
+
+#ifndef ORG_TABLE_H
+#define ORG_TABLE_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+#include "geometry/Angle2D.h"
+#include "geometry/Point2D.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+
+///< Standard C++ includes
+#include <algorithm>
+#include <cstdint>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+class OrgTable
+{
+  private:
+
+    emp::vector<double> x;              ///< Center of each organism
+    emp::vector<double> y;
+    emp::vector<double> radius;         ///< Radius of each organism (0 for empty slots)
+    emp::vector<double> energy;         ///< Energy of each organism
+    emp::vector<emp::Angle> facing;     ///< Direction each organism is facing
+    emp::vector<size_t> heat;           ///< Heat id of each organism
+    emp::vector<uint64_t> alive;        ///< Bit per slot: is there an organism in this slot?
+    size_t num_slots = 0;               ///< Number of slots
+
+    ///< Metabolize the 64 slots covered by one mask word and return their birth and starvation bits.
+    void SweepWord(size_t word, double cost_per_radius, double birth_thresh, uint64_t & birth_bits, uint64_t & starve_bits);
+
+  public:
+
+    /* Functions dedicated to maintaining the table */
+
+    void Resize(size_t size);                                     ///< Make room for world ids [0, size)
+    void Reserve(size_t size);                                    ///< Preallocate room without using it
+    void Add(size_t wid, emp::Point center, double r, emp::Angle f, double e, size_t h);
+    void Remove(size_t wid);                                      ///< Empty a slot
+
+
+    /* Getter functions */
+
+    size_t GetSize() const { return num_slots; }
+    bool IsAlive(size_t wid) const { return wid < num_slots && (alive[wid >> 6] >> (wid & 63)) & 1; }
+    emp::Point GetCenter(size_t wid) const { emp_assert(wid < x.size(), wid); return emp::Point(x[wid], y[wid]); }
+    double GetRadius(size_t wid) const { emp_assert(wid < radius.size(), wid); return radius[wid]; }
+    double GetEnergy(size_t wid) const { emp_assert(wid < energy.size(), wid); return energy[wid]; }
+    emp::Angle GetFacing(size_t wid) const { emp_assert(wid < facing.size(), wid); return facing[wid]; }
+    size_t GetHeat(size_t wid) const { emp_assert(wid < heat.size(), wid); return heat[wid]; }
+
+    double * GetEnergyData() { return energy.data(); }              ///< Raw arrays for sweeps
+    const double * GetRadiusData() const { return radius.data(); }
+
+
+    /* Setter functions */
+
+    void SetCenter(size_t wid, emp::Point center) { emp_assert(wid < x.size(), wid); x[wid] = center.GetX(); y[wid] = center.GetY(); }
+    void SetRadius(size_t wid, double r) { emp_assert(wid < radius.size(), wid); radius[wid] = r; }
+    void SetEnergy(size_t wid, double e) { emp_assert(wid < energy.size(), wid); energy[wid] = e; }
+    void SetHeat(size_t wid, size_t h) { emp_assert(wid < heat.size(), wid); heat[wid] = h; }
+    void SetFacing(size_t wid, emp::Angle f) { emp_assert(wid < facing.size(), wid); facing[wid] = f; }
+
+    ///< Subtract energy from an organism!
+    void SubEnergy(size_t wid, double e) { emp_assert(wid < energy.size(), wid); energy[wid] -= e; }
+    ///< Add energy to an organism, up to cap!
+    void AddEnergy(size_t wid, double e, double cap)
+    {
+      emp_assert(wid < energy.size(), wid);
+      (energy[wid] + e > cap) ? energy[wid] = cap : energy[wid] += e;
+    }
+    ///< Rotate the direction an organism is facing!
+    void RotateDegrees(size_t wid, double degrees) { emp_assert(wid < facing.size(), wid); facing[wid].RotateDegrees(degrees); }
+
+
+    /* Functions dedicated to sweeps over the whole table */
+
+    ///< energy -= cost_per_radius * radius for every slot, then flag every live org with
+    ///< energy > birth_thresh in birth_mask and energy <= 0 in starve_mask (bit wid of word wid/64).
+    void Sweep(double cost_per_radius, double birth_thresh, emp::vector<uint64_t> & birth_mask, emp::vector<uint64_t> & starve_mask);
+    static bool Test(const emp::vector<uint64_t> & mask, size_t wid) { return (mask[wid >> 6] >> (wid & 63)) & 1; }
+
+
+    /* Functions dedicated to checkpoints */
+
+    void Save(CheckpointWriter & out) const;
+    void Load(CheckpointReader & in);
+};
+
+
+/* Functions dedicated to maintaining the table */
+
+void OrgTable::Resize(size_t size)
+{
+  x.resize(size, 0.0);
+  y.resize(size, 0.0);
+  radius.resize(size, 0.0);
+  energy.resize(size, 0.0);
+  facing.resize(size);
+  heat.resize(size, 0);
+  alive.resize((size + 63) / 64, 0);
+
+  // Forget slots that were cut off when shrinking.
+  if(size < num_slots && (size & 63)) { alive[size >> 6] &= (uint64_t(1) << (size & 63)) - 1; }
+  num_slots = size;
+}
+
+void OrgTable::Reserve(size_t size)
+{
+  x.reserve(size);
+  y.reserve(size);
+  radius.reserve(size);
+  energy.reserve(size);
+  facing.reserve(size);
+  heat.reserve(size);
+  alive.reserve((size + 63) / 64);
+}
+
+void OrgTable::Add(size_t wid, emp::Point center, double r, emp::Angle f, double e, size_t h)
+{
+  if(wid >= num_slots) { Resize(wid + 1); }
+
+  x[wid] = center.GetX();
+  y[wid] = center.GetY();
+  radius[wid] = r;
+  energy[wid] = e;
+  facing[wid] = f;
+  heat[wid] = h;
+  alive[wid >> 6] |= uint64_t(1) << (wid & 63);
+}
+
+void OrgTable::Remove(size_t wid)
+{
+  emp_assert(wid < num_slots, wid);
+
+  // A zero radius keeps empty slots from changing during sweeps.
+  radius[wid] = 0.0;
+  energy[wid] = 0.0;
+  alive[wid >> 6] &= ~(uint64_t(1) << (wid & 63));
+}
+
+
+/* Functions dedicated to sweeps over the whole table */
+
+void OrgTable::SweepWord(size_t word, double cost_per_radius, double birth_thresh, uint64_t & birth_bits, uint64_t & starve_bits)
+{
+  double * e = energy.data();
+  const double * r = radius.data();
+  const size_t begin = word << 6;
+  const size_t end = std::min(num_slots, begin + 64);
+  size_t i = begin;
+  birth_bits = 0;
+  starve_bits = 0;
+
+#ifdef __AVX2__
+  // Four slots at a time; the compare masks are packed straight into the bit words.
+  const __m256d cost = _mm256_set1_pd(cost_per_radius);
+  const __m256d thresh = _mm256_set1_pd(birth_thresh);
+  const __m256d zero = _mm256_setzero_pd();
+  for(; i + 4 <= end; i += 4)
+  {
+    __m256d ev = _mm256_loadu_pd(e + i);
+    ev = _mm256_sub_pd(ev, _mm256_mul_pd(cost, _mm256_loadu_pd(r + i)));
+    _mm256_storeu_pd(e + i, ev);
+
+    const uint64_t shift = i - begin;
+    birth_bits |= (uint64_t) _mm256_movemask_pd(_mm256_cmp_pd(ev, thresh, _CMP_GT_OQ)) << shift;
+    starve_bits |= (uint64_t) _mm256_movemask_pd(_mm256_cmp_pd(ev, zero, _CMP_LE_OQ)) << shift;
+  }
+#endif
+
+  for(; i < end; ++i)
+  {
+    e[i] -= cost_per_radius * r[i];
+    birth_bits |= (uint64_t) (e[i] > birth_thresh) << (i - begin);
+    starve_bits |= (uint64_t) (e[i] <= 0.0) << (i - begin);
+  }
+}
+
+void OrgTable::Sweep(double cost_per_radius, double birth_thresh, emp::vector<uint64_t> & birth_mask, emp::vector<uint64_t> & starve_mask)
+{
+  const size_t words = alive.size();
+  birth_mask.resize(words);
+  starve_mask.resize(words);
+
+  // World ids are reused, so the table only spans the largest live population; whole dead words are skipped.
+  for(size_t w = 0; w < words; ++w)
+  {
+    if(alive[w] == 0)
+    {
+      birth_mask[w] = 0;
+      starve_mask[w] = 0;
+      continue;
+    }
+
+    uint64_t birth_bits, starve_bits;
+    SweepWord(w, cost_per_radius, birth_thresh, birth_bits, starve_bits);
+
+    // Empty slots sit at zero energy, so only keep the bits of live orgs.
+    birth_mask[w] = birth_bits & alive[w];
+    starve_mask[w] = starve_bits & alive[w];
+  }
+}
+
+
+/* Functions dedicated to checkpoints */
+
+void OrgTable::Save(CheckpointWriter & out) const
+{
+  out.Write<uint64_t>(num_slots);
+  out.WriteVector(x);
+  out.WriteVector(y);
+  out.WriteVector(radius);
+  out.WriteVector(energy);
+  out.WriteVector(heat);
+  out.WriteVector(alive);
+  for(const emp::Angle & f : facing) { out.WriteRaw(f); }
+}
+
+void OrgTable::Load(CheckpointReader & in)
+{
+  num_slots = in.Read<uint64_t>();
+  in.ReadVector(x);
+  in.ReadVector(y);
+  in.ReadVector(radius);
+  in.ReadVector(energy);
+  in.ReadVector(heat);
+  in.ReadVector(alive);
+  facing.resize(num_slots);
+  for(emp::Angle & f : facing) { in.ReadRaw(f); }
+}
+
+#endif
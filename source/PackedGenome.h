@@ -0,0 +1,176 @@
+/// This is a compact SignalGP genome: 5 bytes per instruction (opcode, three 5-bit args, 16-bit tag).
+/// Genomes are copied (and checkpointed) in this form; programs are only unpacked to run (in a brain) or to mutate.
+
+#ifndef PACKED_GENOME_H
+#define PACKED_GENOME_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+
+///< Standard C++ includes
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+class PackedGenome
+{
+  public:
+
+    static constexpr size_t ARG_BITS = 5;                           ///< Args 0..31 (PROGRAM_MAX_ARG_VAL is 16)
+    static constexpr int MAX_ARG = (1 << ARG_BITS) - 1;
+    static constexpr size_t MAX_OP = 255;
+
+    struct PackedInst                                                ///< Bytes only, so records sit back to back
+    {
+      uint8_t op;
+      uint8_t args[2];                  ///< arg0 in bits 0-4, arg1 in bits 5-9, arg2 in bits 10-14 (little endian)
+      uint8_t tag[2];                   ///< 16-bit affinity (little endian)
+
+      int GetArg(size_t i) const { return ((args[0] | (args[1] << 8)) >> (i * ARG_BITS)) & MAX_ARG; }
+      uint16_t GetTag() const { return tag[0] | (tag[1] << 8); }
+    };
+    static_assert(sizeof(PackedInst) == 5, "Packed instructions must be 5 bytes");
+
+  private:
+
+    emp::vector<uint16_t> fun_tags;     ///< Affinity of each function
+    emp::vector<uint32_t> fun_ends;     ///< One past the last instruction of each function
+    emp::vector<PackedInst> insts;      ///< Every function's instructions back to back
+
+  public:
+
+    /* Getter functions */
+
+    size_t GetNumFunctions() const { return fun_tags.size(); }
+    size_t GetSize() const { return insts.size(); }
+    size_t GetBytes() const { return sizeof(uint16_t) * fun_tags.size() + sizeof(uint32_t) * fun_ends.size() + sizeof(PackedInst) * insts.size(); }
+    size_t GetFunctionBegin(size_t f) const { return (f) ? fun_ends[f - 1] : 0; }
+    size_t GetFunctionEnd(size_t f) const { return fun_ends[f]; }
+    uint16_t GetFunctionTag(size_t f) const { return fun_tags[f]; }
+    const PackedInst & GetInst(size_t i) const { return insts[i]; }
+    bool operator==(const PackedGenome & in) const;
+    bool operator!=(const PackedGenome & in) const { return !(*this == in); }
+    uint64_t Hash() const;                                          ///< FNV-1a over the packed bytes
+
+
+    /* Functions dedicated to building genomes */
+
+    void Clear() { fun_tags.clear(); fun_ends.clear(); insts.clear(); }
+    void PushFunction(uint16_t tag=0) { fun_tags.push_back(tag); fun_ends.push_back(insts.size()); }
+    void PushInst(size_t op, int a0=0, int a1=0, int a2=0, uint16_t tag=0);   ///< Into the last function
+
+
+    /* Functions dedicated to converting to and from SignalGP programs */
+
+    template <typename PROGRAM_T>
+    void Encode(const PROGRAM_T & program);
+
+    ///< Rebuild the functions into program (which keeps its instruction library).
+    template <typename PROGRAM_T>
+    void DecodeProgram(PROGRAM_T & program) const;
+
+    ///< Rebuild the program inside the hardware (which needs the unpacked form to run).
+    template <typename HARDWARE_T>
+    void Decode(HARDWARE_T & hw) const;
+
+
+    /* Functions dedicated to checkpoints */
+
+    void Save(CheckpointWriter & out) const { out.WriteVector(fun_tags); out.WriteVector(fun_ends); out.WriteVector(insts); }
+    void Load(CheckpointReader & in) { in.ReadVector(fun_tags); in.ReadVector(fun_ends); in.ReadVector(insts); }
+};
+
+
+/* Getter functions */
+
+bool PackedGenome::operator==(const PackedGenome & in) const
+{
+  return fun_tags == in.fun_tags && fun_ends == in.fun_ends && insts.size() == in.insts.size()
+         && (insts.empty() || std::memcmp(insts.data(), in.insts.data(), sizeof(PackedInst) * insts.size()) == 0);
+}
+
+
+uint64_t PackedGenome::Hash() const
+{
+  uint64_t h = 0xCBF29CE484222325ull;
+  auto mix = [&h](const void * data, size_t size)
+  {
+    const uint8_t * bytes = static_cast<const uint8_t *>(data);
+    for(size_t i = 0; i < size; ++i) { h = (h ^ bytes[i]) * 0x100000001B3ull; }
+  };
+  mix(fun_tags.data(), sizeof(uint16_t) * fun_tags.size());
+  mix(fun_ends.data(), sizeof(uint32_t) * fun_ends.size());
+  mix(insts.data(), sizeof(PackedInst) * insts.size());
+  return h;
+}
+
+
+/* Functions dedicated to building genomes */
+
+void PackedGenome::PushInst(size_t op, int a0, int a1, int a2, uint16_t tag)
+{
+  emp_assert(fun_tags.size(), "PushFunction before PushInst");
+  emp_assert(op <= MAX_OP, op);
+  emp_assert(a0 >= 0 && a0 <= MAX_ARG && a1 >= 0 && a1 <= MAX_ARG && a2 >= 0 && a2 <= MAX_ARG, a0, a1, a2);
+
+  const uint16_t args = a0 | (a1 << ARG_BITS) | (a2 << (2 * ARG_BITS));
+  insts.push_back({(uint8_t) op, {(uint8_t) args, (uint8_t) (args >> 8)}, {(uint8_t) tag, (uint8_t) (tag >> 8)}});
+  fun_ends.back() = insts.size();
+}
+
+
+/* Functions dedicated to converting to and from SignalGP programs */
+
+template <typename PROGRAM_T>
+void PackedGenome::Encode(const PROGRAM_T & program)
+{
+  Clear();
+  for(size_t f = 0; f < program.GetSize(); ++f)
+  {
+    const auto & fun = program[f];
+    PushFunction(fun.affinity.GetUInt(0));
+    for(const auto & inst : fun.inst_seq)
+    {
+      PushInst(inst.id, inst.args[0], inst.args[1], inst.args[2], inst.affinity.GetUInt(0));
+    }
+  }
+}
+
+template <typename PROGRAM_T>
+void PackedGenome::DecodeProgram(PROGRAM_T & program) const
+{
+  using function_t = typename std::decay<decltype(program[0])>::type;
+  using inst_t = typename decltype(function_t::inst_seq)::value_type;
+  using affinity_t = decltype(function_t::affinity);
+
+  // Clearing keeps the program's instruction library.
+  program.Clear();
+
+  for(size_t f = 0; f < GetNumFunctions(); ++f)
+  {
+    function_t fun;
+    fun.affinity.SetUInt(0, fun_tags[f]);
+    fun.inst_seq.reserve(GetFunctionEnd(f) - GetFunctionBegin(f));
+    for(size_t i = GetFunctionBegin(f); i < GetFunctionEnd(f); ++i)
+    {
+      const PackedInst & rec = insts[i];
+      affinity_t tag;
+      tag.SetUInt(0, rec.GetTag());
+      fun.inst_seq.emplace_back(inst_t(rec.op, rec.GetArg(0), rec.GetArg(1), rec.GetArg(2), tag));
+    }
+    program.PushFunction(fun);
+  }
+}
+
+template <typename HARDWARE_T>
+void PackedGenome::Decode(HARDWARE_T & hw) const
+{
+  // Built in place, so the brain's program is the only unpacked copy.
+  DecodeProgram(hw.GetProgram());
+}
+
+#endif
@@ -0,0 +1,224 @@
+/// This is a genotype phylogeny that only keeps the part of the tree living organisms still need.
+
+#ifndef PHYLOGENY_H
+#define PHYLOGENY_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+
+///< Standard C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+
+/// A taxon is a genotype that appeared at a birth (or injection).  Taxa that lose their last organism
+/// are pruned if nothing descends from them, and spliced out (their child takes their place) if only
+/// one line does.  Every taxon left either has organisms or joins two living lines, so the tree never
+/// holds more than twice as many taxa as there are living genotypes.  With a single root, that root is
+/// the most recent common ancestor of everything alive.
+
+class Phylogeny
+{
+  public:
+
+    static constexpr size_t NONE = (size_t) -1;
+
+    struct Taxon
+    {
+      size_t parent = NONE;             ///< Closest ancestor still in the tree
+      emp::vector<size_t> children;     ///< Taxa in the tree whose closest ancestor is this one
+      uint64_t genome_hash = 0;         ///< Identifies the genotype (ids in the genome table get reused)
+      size_t origin = 0;                ///< Update the taxon appeared
+      size_t depth = 0;                 ///< Genotype changes since the root (spliced ancestors count)
+      size_t count = 0;                 ///< Living organisms (and pending offspring)
+      bool used = false;
+    };
+
+  private:
+
+    emp::vector<Taxon> taxa;            ///< Indexed by taxon id
+    emp::vector<size_t> free_ids;       ///< Slots to reuse
+    emp::vector<size_t> roots;          ///< Taxa without an ancestor in the tree
+    size_t num_taxa = 0;
+    size_t total_taxa = 0;              ///< Taxa ever created
+
+    void Detach(size_t id, size_t replacement);   ///< Take id out of its parent's children (or the roots)
+    void Free(size_t id);
+    void Collapse(size_t id);                     ///< Prune or splice id if it no longer has organisms
+
+  public:
+
+    /* Getter functions */
+
+    size_t GetNumTaxa() const { return num_taxa; }
+    size_t GetTotalTaxa() const { return total_taxa; }
+    size_t GetNumRoots() const { return roots.size(); }
+    bool IsUsed(size_t id) const { return id < taxa.size() && taxa[id].used; }
+    const Taxon & Get(size_t id) const { emp_assert(IsUsed(id), id); return taxa[id]; }
+    size_t GetMRCA() const { return (roots.size() == 1) ? roots[0] : NONE; }   ///< NONE if lines never met
+    int GetMRCADepth() const { return (roots.size() == 1) ? (int) taxa[roots[0]].depth : -1; }
+
+
+    /* Functions dedicated to maintaining the tree */
+
+    size_t AddTaxon(size_t parent, uint64_t genome_hash, size_t update);     ///< New taxon (no organisms yet)
+    void AddRef(size_t id) { emp_assert(IsUsed(id), id); taxa[id].count++; }
+    void Release(size_t id);
+    void ClearCounts();                                                       ///< Drop every reference (for checkpoints)
+
+
+    /* Functions dedicated to output */
+
+    static const char * Header() { return "update,taxon,parent,genome_hash,origin,depth,count"; }
+    void Write(std::ostream & os, size_t update) const;                      ///< One CSV row per taxon in the tree
+
+
+    /* Functions dedicated to checkpoints */
+
+    void Save(CheckpointWriter & out) const;
+    void Load(CheckpointReader & in);
+};
+
+
+/* Functions dedicated to maintaining the tree */
+
+size_t Phylogeny::AddTaxon(size_t parent, uint64_t genome_hash, size_t update)
+{
+  emp_assert(parent == NONE || IsUsed(parent), parent);
+
+  size_t id;
+  if(free_ids.size()) { id = free_ids.back(); free_ids.pop_back(); }
+  else { id = taxa.size(); taxa.emplace_back(); }
+
+  Taxon & taxon = taxa[id];
+  taxon.parent = parent;
+  taxon.children.clear();
+  taxon.genome_hash = genome_hash;
+  taxon.origin = update;
+  taxon.depth = (parent == NONE) ? 0 : taxa[parent].depth + 1;
+  taxon.count = 0;
+  taxon.used = true;
+
+  if(parent == NONE) { roots.push_back(id); }
+  else { taxa[parent].children.push_back(id); }
+  num_taxa++;
+  total_taxa++;
+  return id;
+}
+
+void Phylogeny::Release(size_t id)
+{
+  emp_assert(IsUsed(id) && taxa[id].count > 0, id);
+  if(--taxa[id].count == 0) { Collapse(id); }
+}
+
+void Phylogeny::Detach(size_t id, size_t replacement)
+{
+  emp::vector<size_t> & list = (taxa[id].parent == NONE) ? roots : taxa[taxa[id].parent].children;
+  auto it = std::find(list.begin(), list.end(), id);
+  emp_assert(it != list.end(), id);
+  if(replacement != NONE) { *it = replacement; }
+  else { *it = list.back(); list.pop_back(); }
+}
+
+void Phylogeny::Free(size_t id)
+{
+  Taxon & taxon = taxa[id];
+  taxon.children.clear();
+  taxon.used = false;
+  free_ids.push_back(id);
+  num_taxa--;
+}
+
+void Phylogeny::Collapse(size_t id)
+{
+  Taxon & taxon = taxa[id];
+  if(taxon.count) { return; }
+
+  // Extinct with nothing below: prune, and the parent may now be a dead end (or a plain link) too.
+  if(taxon.children.empty())
+  {
+    const size_t parent = taxon.parent;
+    Detach(id, NONE);
+    Free(id);
+    if(parent != NONE) { Collapse(parent); }
+  }
+  // Extinct on a single line: the child takes its place.
+  else if(taxon.children.size() == 1)
+  {
+    const size_t child = taxon.children[0];
+    Detach(id, child);
+    taxa[child].parent = taxon.parent;
+    Free(id);
+  }
+}
+
+void Phylogeny::ClearCounts()
+{
+  for(Taxon & taxon : taxa) { taxon.count = 0; }
+}
+
+
+/* Functions dedicated to output */
+
+void Phylogeny::Write(std::ostream & os, size_t update) const
+{
+  for(size_t id = 0; id < taxa.size(); ++id)
+  {
+    const Taxon & taxon = taxa[id];
+    if(!taxon.used) { continue; }
+    os << update << "," << id << "," << (taxon.parent == NONE ? -1 : (long long) taxon.parent) << ","
+       << taxon.genome_hash << "," << taxon.origin << "," << taxon.depth << "," << taxon.count << "\n";
+  }
+}
+
+
+/* Functions dedicated to checkpoints */
+
+void Phylogeny::Save(CheckpointWriter & out) const
+{
+  out.Write<uint64_t>(taxa.size());
+  out.Write<uint64_t>(num_taxa);
+  out.Write<uint64_t>(total_taxa);
+  out.WriteVector(roots);
+  for(size_t id = 0; id < taxa.size(); ++id)
+  {
+    const Taxon & taxon = taxa[id];
+    if(!taxon.used) { continue; }
+    out.Write<uint64_t>(id);
+    out.Write<uint64_t>(taxon.parent);
+    out.WriteVector(taxon.children);
+    out.Write<uint64_t>(taxon.genome_hash);
+    out.Write<uint64_t>(taxon.origin);
+    out.Write<uint64_t>(taxon.depth);
+    out.Write<uint64_t>(taxon.count);
+  }
+}
+
+void Phylogeny::Load(CheckpointReader & in)
+{
+  taxa.clear();
+  free_ids.clear();
+  taxa.resize(in.Read<uint64_t>());
+  num_taxa = in.Read<uint64_t>();
+  total_taxa = in.Read<uint64_t>();
+  in.ReadVector(roots);
+  for(size_t i = 0; i < num_taxa; ++i)
+  {
+    Taxon & taxon = taxa[in.Read<uint64_t>()];
+    taxon.parent = in.Read<uint64_t>();
+    in.ReadVector(taxon.children);
+    taxon.genome_hash = in.Read<uint64_t>();
+    taxon.origin = in.Read<uint64_t>();
+    taxon.depth = in.Read<uint64_t>();
+    taxon.count = in.Read<uint64_t>();
+    taxon.used = true;
+  }
+  for(size_t id = taxa.size(); id-- > 0; ) { if(!taxa[id].used) { free_ids.push_back(id); } }
+}
+
+#endif
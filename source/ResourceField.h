@@ -0,0 +1,171 @@
+/// This is a continuous resource: a concentration grid over the (toroidal) world that diffuses and regrows.
+
+#ifndef RESOURCE_FIELD_H
+#define RESOURCE_FIELD_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+#include "geometry/Point2D.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+
+///< Standard C++ includes
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <utility>
+
+/// Food is an amount per cell instead of a body per resource, so eating is a lookup in the cell
+/// under the organism and nothing has to be found by overlap.  Each step is an explicit diffusion
+/// step (5-point stencil) followed by logistic regrowth towards the capacity.  Rows only read the
+/// current grid and write their own row of the next one, so they can be stepped in any order (or in
+/// parallel), and the inner loops are plain array arithmetic the compiler can vectorise.
+
+class ResourceField
+{
+  private:
+
+    double world_x;                     ///< Size of the world
+    double world_y;
+    size_t cols;                        ///< Number of cells per axis
+    size_t rows;
+    double cell_w;                      ///< Size of each cell (cells tile the world exactly)
+    double cell_h;
+
+    double capacity;                    ///< Most a cell regrows to
+    double diffusion;                   ///< Share exchanged with each neighbour per step (at most 0.25)
+    double regrowth;                    ///< Logistic growth rate per step
+
+    emp::vector<double> conc;           ///< Amount in each cell, row major
+    emp::vector<double> next;           ///< Written by StepRow, swapped in by Swap
+
+  public:
+
+    /* Constructors */
+
+    ResourceField(double _world_x, double _world_y, double cell_size, double _capacity, double _diffusion, double _regrowth);
+
+
+    /* Getter functions */
+
+    size_t GetCols() const { return cols; }
+    size_t GetRows() const { return rows; }
+    double GetCellW() const { return cell_w; }
+    double GetCellH() const { return cell_h; }
+    double GetCapacity() const { return capacity; }
+    double Get(size_t col, size_t row) const { emp_assert(col < cols && row < rows, col, row); return conc[row * cols + col]; }
+    size_t CellOf(const emp::Point & p) const;                    ///< Which cell holds a (wrapped) point?
+    double GetAt(const emp::Point & p) const { return conc[CellOf(p)]; }   ///< Amount in the cell under p
+    double GetTotal() const;                                      ///< Sum over the whole field
+
+
+    /* Functions dedicated to the field */
+
+    double Take(const emp::Point & p, double amount);             ///< Remove up to amount from the cell under p, return what was taken
+    void StepRow(size_t row);                                     ///< Diffuse and regrow one row into the next grid
+    void Swap() { std::swap(conc, next); }                        ///< Make the next grid current (after every row stepped)
+    void Step() { for(size_t row = 0; row < rows; ++row) { StepRow(row); } Swap(); }
+
+
+    /* Functions dedicated to checkpoints */
+
+    void Save(CheckpointWriter & out) const { out.WriteVector(conc); }
+    void Load(CheckpointReader & in);
+};
+
+
+/* Constructors */
+
+ResourceField::ResourceField(double _world_x, double _world_y, double cell_size, double _capacity, double _diffusion, double _regrowth)
+  : world_x(_world_x), world_y(_world_y), capacity(_capacity), diffusion(_diffusion), regrowth(_regrowth)
+{
+  emp_assert(world_x > 0.0 && world_y > 0.0);
+  if(cell_size <= 0.0 || capacity <= 0.0)
+  {
+    std::cerr << "ERROR: Resource field cells and capacity must be positive" << std::endl;
+    exit(-1);
+  }
+  // Explicit diffusion goes unstable (cells oscillate negative) past a quarter per neighbour.
+  if(diffusion < 0.0 || diffusion > 0.25)
+  {
+    std::cerr << "ERROR: Resource field diffusion must lie in [0, 0.25]" << std::endl;
+    exit(-1);
+  }
+
+  cols = std::max<size_t>(1, (size_t) (world_x / cell_size));
+  rows = std::max<size_t>(1, (size_t) (world_y / cell_size));
+  cell_w = world_x / (double) cols;
+  cell_h = world_y / (double) rows;
+  conc.resize(cols * rows, capacity);
+  next.resize(cols * rows, capacity);
+}
+
+
+/* Getter functions */
+
+size_t ResourceField::CellOf(const emp::Point & p) const
+{
+  const size_t cx = std::min(cols - 1, (size_t) (std::max(0.0, p.GetX()) / cell_w));
+  const size_t cy = std::min(rows - 1, (size_t) (std::max(0.0, p.GetY()) / cell_h));
+  return cy * cols + cx;
+}
+
+double ResourceField::GetTotal() const
+{
+  double total = 0.0;
+  for(double c : conc) { total += c; }
+  return total;
+}
+
+
+/* Functions dedicated to the field */
+
+double ResourceField::Take(const emp::Point & p, double amount)
+{
+  double & cell = conc[CellOf(p)];
+  const double taken = std::min(cell, amount);
+  cell -= taken;
+  return taken;
+}
+
+void ResourceField::StepRow(size_t row)
+{
+  emp_assert(row < rows, row);
+  const double * up = conc.data() + ((row + rows - 1) % rows) * cols;
+  const double * mid = conc.data() + row * cols;
+  const double * down = conc.data() + ((row + 1) % rows) * cols;
+  double * out = next.data() + row * cols;
+
+  // Interior columns have both neighbours in the row; the two border columns wrap around.
+  for(size_t c = 1; c + 1 < cols; ++c)
+  {
+    out[c] = mid[c] + diffusion * (up[c] + down[c] + mid[c - 1] + mid[c + 1] - 4.0 * mid[c]);
+  }
+  const size_t last = cols - 1;
+  out[0] = mid[0] + diffusion * (up[0] + down[0] + mid[last] + mid[(cols > 1) ? 1 : 0] - 4.0 * mid[0]);
+  if(cols > 1) { out[last] = mid[last] + diffusion * (up[last] + down[last] + mid[last - 1] + mid[0] - 4.0 * mid[last]); }
+
+  // Logistic regrowth towards capacity (an empty cell only refills from its neighbours).
+  const double inv_capacity = 1.0 / capacity;
+  for(size_t c = 0; c < cols; ++c)
+  {
+    out[c] += regrowth * out[c] * (1.0 - out[c] * inv_capacity);
+  }
+}
+
+
+/* Functions dedicated to checkpoints */
+
+void ResourceField::Load(CheckpointReader & in)
+{
+  in.ReadVector(conc);
+  if(conc.size() != cols * rows)
+  {
+    std::cerr << "ERROR: Checkpoint field has " << conc.size() << " cells, expected " << cols * rows << std::endl;
+    exit(-1);
+  }
+}
+
+#endif
@@ -11,11 +11,20 @@
 ///< Experiment headers
 #include "config.h"
 #include "BeakerResource.h"
+#include "Checkpoint.h"
+
+///< Standard C++ includes
+#include <algorithm>
+#include <cstdint>
 
 ///< Managing resources directly
 using man_t = emp::vector<BeakerResource>;  
-///< Keeping tabs on resources (consumed or not)
-using tab_t = emp::vector<bool>; 
+///< Keeping tabs on resources (bit per resource: is it on the surface?)
+using tab_t = emp::vector<uint64_t>; 
+
+/// Every resource is either on the surface or waiting to respawn, and its due update says when
+/// that next changes.  Resources are filed on a timing wheel under their due update, so each
+/// update only looks at the resources that change then.
 
 
 class ResourceManager
@@ -25,23 +34,33 @@ class ResourceManager
 		BeakerConfig & config;      ///< BeakerConfig for possible values
 
 		man_t manager;			    		///< Structure to hold all resources for a given sector
-		tab_t tabs;									///< Structure to tell if a resource has been eaten or not
+		tab_t alive;								///< Structure to tell if a resource is on the surface (one bit each)
+		emp::vector<emp::vector<size_t>> wheel;		///< Resources due at update u are in wheel[u & wheel_mask]
+		size_t wheel_mask;
+		emp::vector<emp::Point> patches;			///< Centers resources spawn around (SpawnMode::PATCHES)
+
+		void Schedule(size_t mid, size_t due);		///< File mid on the wheel for update due
+		void SetAlive(size_t mid) { alive[mid >> 6] |= uint64_t(1) << (mid & 63); }
+		void SetDead(size_t mid) { alive[mid >> 6] &= ~(uint64_t(1) << (mid & 63)); }
 
 
 	public:
 
+		static constexpr size_t NEVER = (size_t) -1;
+		enum class SpawnMode {UNIFORM, PATCHES, CLUSTERS};		///< RESOURCE_SPAWN values
+
 		/* Constructors, Destructors, and Operators */
 
 		ResourceManager(BeakerConfig & _config) : config(_config)
 		{
-			emp_assert(config.RESOURCE_UPS_MAX() > 0, config.RESOURCE_UPS_MAX());
 			PopulateManagers();
 		}
 
 		~ResourceManager()
 		{
 			manager.clear();
-			tabs.clear();
+			alive.clear();
+			wheel.clear();
 		}
 
 		const BeakerResource & operator[](size_t id);
@@ -54,26 +73,40 @@ class ResourceManager
 
 		/* Functions dedicated to maintain manager */
 
-		void Consumed(size_t mid);									///< Set resource as been consumed 
-		bool Alive(size_t mid);											///< Is the resource still alive? 
-		void Reset();																///< Reset everything to not consumed (false)
-		bool Expired(size_t mid);										///< Has a specific resource expired? 
-		void Increment();														///< Increment all resource update count
+		void Spawn(size_t mid, size_t now, size_t life);		///< Resource is on the surface until now + life (0 for never)
+		void Spawn(size_t mid, size_t now) { Spawn(mid, now, config.RESOURCE_UPS_MAX()); }
+		void Consumed(size_t mid, size_t now);						///< Set resource as been consumed (respawns after the delay)
+		bool Alive(size_t mid) const;								///< Is the resource on the surface? 
+		void Reset();												///< Take every resource off the surface
+		bool Expired(size_t mid, size_t now) const;				///< Does a resource on the surface expire now?
+
+		///< Resources due at now: the ones that expire go in expired, the ones to put back go in respawn
+		///< (an expired resource is in both when there is no respawn delay).  The caller moves them.
+		void Advance(size_t now, emp::vector<size_t> & expired, emp::vector<size_t> & respawn);
 
 
 		/* Getter and setter functions */
 
-		const man_t GetMana() const { return manager; };			///< Get class manager containers
-		const tab_t GetTabs() const { return  tabs; };
+		const man_t & GetMana() const { return manager; };			///< Get class manager containers (read only, no copy)
+		const tab_t & GetAliveMask() const { return alive; };
+		size_t GetNumAlive() const;											///< Popcount of the alive mask
+
+		///< Call fun(mid) for every resource on the surface, in id order (walks set bits, allocates nothing).
+		template <typename FUN_T>
+		void ForEachAlive(FUN_T && fun) const;
 
-		size_t GetMapID(size_t pos);													///< Get resource variables
-		size_t GetSurfaceID(size_t pos);
+		size_t GetMapID(size_t pos) const;													///< Get resource variables
+		size_t GetSurfaceID(size_t pos) const;
 
 		BeakerResource & GetRes(size_t mid);									///< Get reference to  resource
 
 		void SetMapID(size_t pos, size_t mid);								///< Set resoruce variables
 		void SetSurfaceID(size_t pos, size_t sid);
 
+		SpawnMode GetSpawnMode() const { return (SpawnMode) config.RESOURCE_SPAWN(); }
+		const emp::vector<emp::Point> & GetPatches() const { return patches; }
+		void SetPatches(const emp::vector<emp::Point> & _in) { patches = _in; }
+
 
 
 		/* Functions dedicated to debugging */
@@ -81,14 +114,16 @@ class ResourceManager
 		void PrintManager();
 
 
-		/* Functions dedicated to */
+		/* Functions dedicated to checkpoints */
+
+		void Save(CheckpointWriter & out) const;
+		void Load(CheckpointReader & in);
 };
 
 /* Constructors, Destructors, and Operators */
 
 const BeakerResource & ResourceManager::operator[](size_t id)
 {
-	emp_assert(id > 0, id);
 	emp_assert(id < manager.size(), id);
 
 	return manager[id];
@@ -101,7 +136,13 @@ void ResourceManager::PopulateManagers()
 {
 	//< Set up the number of sectors for x,y axis
 	manager.resize(config.NUMBER_RESOURCES());
-	tabs.resize(config.NUMBER_RESOURCES(), false);
+	alive.resize((config.NUMBER_RESOURCES() + 63) / 64, 0);		///< Nothing is on the surface until it spawns
+
+	//< Everything is due within the lifetime or the delay, so no two due updates share a bucket
+	size_t span = 1;
+	while(span <= std::max(config.RESOURCE_UPS_MAX(), config.RESOURCE_RESPAWN_DELAY())) { span <<= 1; }
+	wheel.resize(span);
+	wheel_mask = span - 1;
 
 	//< Populate the Manager
 	for(size_t i = 0; i < config.NUMBER_RESOURCES(); ++i)
@@ -128,82 +169,122 @@ void ResourceManager::PopulateManagers()
 
 /* Functions dedicated to maintain manager */
 
-bool ResourceManager::Alive(size_t mid) 					///< Has the resource been eaten yet?
+void ResourceManager::Schedule(size_t mid, size_t due)
 {
-	emp_assert(mid < tabs.size(), mid);
-	emp_assert(tabs[mid].GetInit() == true, tabs[mid].GetInit());
-	return tabs[mid];
+	manager[mid].SetDue(due);
+	if(due != NEVER) { wheel[due & wheel_mask].push_back(mid); }
 }
 
-void ResourceManager::Consumed(size_t mid)				///< Resource has been consumed
+void ResourceManager::Spawn(size_t mid, size_t now, size_t life)	///< Resource is back on the surface
 {
-	emp_assert(mid < tabs.size(), mid);
-	emp_assert(tabs[mid].GetInit() == true, tabs[mid].GetInit());
-	tabs[mid] = true;
+	emp_assert(mid < manager.size(), mid);
+	emp_assert(manager[mid].GetInit() == true, manager[mid].GetInit());
+	SetAlive(mid);
+	Schedule(mid, (life) ? now + life : NEVER);
 }
 
-void ResourceManager::Reset()										///< Reset everything to not consumed
+bool ResourceManager::Alive(size_t mid) const 				///< Is the resource on the surface?
 {
-	tabs.clear();
-	tabs.resize(config.NUMBER_RESOURCES(), false);
+	emp_assert(mid < manager.size(), mid);
+	return (alive[mid >> 6] >> (mid & 63)) & 1;
 }
 
-bool ResourceManager::Expired(size_t mid)
+void ResourceManager::Consumed(size_t mid, size_t now)		///< Resource has been consumed
 {
-	emp_assert(mid > 0, mid);
 	emp_assert(mid < manager.size(), mid);
-	
-	return manager[mid].Expired(config.RESOURCE_UPS_MAX());
+	emp_assert(manager[mid].GetInit() == true, manager[mid].GetInit());
+	SetDead(mid);
+	Schedule(mid, now + config.RESOURCE_RESPAWN_DELAY());
+}
+
+void ResourceManager::Reset()										///< Take everything off the surface
+{
+	std::fill(alive.begin(), alive.end(), 0);			///< A word at a time, no reallocation
+	for(BeakerResource & res : manager) { res.SetDue(NEVER); }
+	for(emp::vector<size_t> & bucket : wheel) { bucket.clear(); }
+}
+
+bool ResourceManager::Expired(size_t mid, size_t now) const
+{
+	emp_assert(mid < manager.size(), mid);
+	return Alive(mid) && manager[mid].GetDue() == now;
 } 
 
-void ResourceManager::Increment()
+void ResourceManager::Advance(size_t now, emp::vector<size_t> & expired, emp::vector<size_t> & respawn)
 {
-	for(size_t i = 0; i < manager.size(); ++i)
+	emp::vector<size_t> & bucket = wheel[now & wheel_mask];
+
+	//< Resources that were rescheduled leave stale entries behind; they are skipped below.  Sorting
+	//< keeps the order the same however the bucket was filled (e.g. rebuilt from a checkpoint).
+	std::sort(bucket.begin(), bucket.end());
+	for(size_t mid : bucket)
 	{
-		
+		if(manager[mid].GetDue() != now) { continue; }
+
+		if(Alive(mid))
+		{
+			SetDead(mid);
+			expired.push_back(mid);
+			if(config.RESOURCE_RESPAWN_DELAY()) { Schedule(mid, now + config.RESOURCE_RESPAWN_DELAY()); continue; }
+		}
+		manager[mid].SetDue(NEVER);			///< Until it spawns (also skips a duplicate entry)
+		respawn.push_back(mid);
 	}
+	bucket.clear();
 }
 
 
 /* Getter and setter functions */
 
+size_t ResourceManager::GetNumAlive() const
+{
+	size_t count = 0;
+	for(uint64_t word : alive) { count += __builtin_popcountll(word); }
+	return count;
+}
+
+template <typename FUN_T>
+void ResourceManager::ForEachAlive(FUN_T && fun) const
+{
+	for(size_t w = 0; w < alive.size(); ++w)
+	{
+		for(uint64_t bits = alive[w]; bits; bits &= bits - 1)
+		{
+			fun((w << 6) + __builtin_ctzll(bits));
+		}
+	}
+}
+
 BeakerResource & ResourceManager::GetRes(size_t mid)
 {
-	emp_assert(mid > 0; mid);
-	emp_assert(mid < config.NUMBER_RESOURCES(), mid);
+	emp_assert(mid < manager.size(), mid);
 	return manager[mid];
 }
 
-size_t ResourceManager::GetMapID(size_t pos)													///< Get resource variables
+size_t ResourceManager::GetMapID(size_t pos) const													///< Get resource variables
 {
-	emp_assert(pos > 0; pos);
-	emp_assert(pos < config.NUMBER_RESOURCES(), pos);
+	emp_assert(pos < manager.size(), pos);
 
 	return manager[pos].GetMapID();
 }
 
-size_t ResourceManager::GetSurfaceID(size_t pos)
+size_t ResourceManager::GetSurfaceID(size_t pos) const
 {
-	emp_assert(pos > 0; pos);
-	emp_assert(pos < config.NUMBER_RESOURCES(), pos);
+	emp_assert(pos < manager.size(), pos);
 
 	return manager[pos].GetSurfaceID();
 }
 
 void ResourceManager::SetMapID(size_t pos, size_t mid)
 {
-	emp_assert(pos > 0, pos); 
 	emp_assert(pos < manager.size(), pos);
-	emp_assert(mid > 0, mid);
 
 	manager[pos].SetMapID(mid);
 }
 
 void ResourceManager::SetSurfaceID(size_t pos, size_t sid)
 {
-	emp_assert(pos > 0, pos); 
 	emp_assert(pos < manager.size(), pos);
-	emp_assert(sid > 0, sid);
 
 	manager[pos].SetSurfaceID(sid);
 }
@@ -222,4 +303,34 @@ void ResourceManager::PrintManager()
 }
 
 
+/* Functions dedicated to checkpoints */
+
+void ResourceManager::Save(CheckpointWriter & out) const
+{
+	out.Write<uint64_t>(manager.size());
+	for(size_t i = 0; i < manager.size(); ++i)
+	{
+		out.Write<uint64_t>(manager[i].GetSurfaceID());
+		out.Write<uint64_t>(manager[i].GetDue());
+	}
+	out.WriteVector(alive);
+}
+
+void ResourceManager::Load(CheckpointReader & in)
+{
+	const uint64_t size = in.Read<uint64_t>();
+	if(size != manager.size())
+	{
+		std::cerr << "ERROR: Checkpoint has " << size << " resources, expected " << manager.size() << std::endl;
+		exit(-1);
+	}
+	for(emp::vector<size_t> & bucket : wheel) { bucket.clear(); }
+	for(size_t i = 0; i < manager.size(); ++i)
+	{
+		manager[i].SetSurfaceID(in.Read<uint64_t>());
+		Schedule(i, in.Read<uint64_t>());			///< The wheel is rebuilt from the due updates
+	}
+	in.ReadVector(alive);
+}
+
 #endif
\ No newline at end of file
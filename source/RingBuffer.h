@@ -0,0 +1,80 @@
+/// This is a preallocated FIFO used to queue world events without allocating every update.
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+template <typename T>
+class RingBuffer
+{
+  private:
+
+    emp::vector<T> buffer;      ///< Storage; size is always a power of two
+    size_t mask;                ///< buffer.size() - 1
+    size_t head;                ///< Position of the front element
+    size_t count;               ///< Number of elements stored
+
+    void Grow();                ///< Double the capacity (only if a guess was too small)
+
+  public:
+
+    /* Constructors */
+
+    RingBuffer(size_t capacity=64);
+
+
+    /* Functions dedicated to the queue */
+
+    void push(const T & in)
+    {
+      if(count == buffer.size()) { Grow(); }
+      buffer[(head + count) & mask] = in;
+      ++count;
+    }
+    const T & front() const { emp_assert(count > 0); return buffer[head]; }
+    void pop() { emp_assert(count > 0); head = (head + 1) & mask; --count; }
+    void clear() { head = 0; count = 0; }
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+    size_t capacity() const { return buffer.size(); }
+
+    void Reserve(size_t capacity);    ///< Make room for at least capacity elements
+};
+
+
+/* Constructors */
+
+template <typename T>
+RingBuffer<T>::RingBuffer(size_t capacity) : mask(0), head(0), count(0)
+{
+  Reserve(capacity);
+}
+
+
+/* Functions dedicated to the queue */
+
+template <typename T>
+void RingBuffer<T>::Reserve(size_t capacity)
+{
+  size_t new_size = 1;
+  while(new_size < capacity) { new_size <<= 1; }
+  if(new_size <= buffer.size()) { return; }
+
+  // Unroll the stored elements to the front of the new buffer.
+  emp::vector<T> new_buffer(new_size);
+  for(size_t i = 0; i < count; ++i) { new_buffer[i] = buffer[(head + i) & mask]; }
+  buffer.swap(new_buffer);
+  mask = new_size - 1;
+  head = 0;
+}
+
+template <typename T>
+void RingBuffer<T>::Grow()
+{
+  Reserve(buffer.size() * 2);
+}
+
+#endif
@@ -0,0 +1,448 @@
+/// This is the BeakerWorld surface: it holds every body and indexes them in a uniform grid
+/// so overlaps on the (toroidal) world can be found by only looking at neighbouring cells.
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+#include "geometry/Point2D.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+
+///< Standard C++ includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+class SpatialGrid
+{
+  public:
+
+    enum class Kind {ORG, RES};         ///< What is being stored in the grid
+
+    struct Body
+    {
+      double x = 0.0;                   ///< Center of the body
+      double y = 0.0;
+      double radius = 0.0;              ///< Radius of the body
+      size_t owner = (size_t) -1;       ///< Organism world id or resource map id
+      size_t cell = 0;                  ///< Which cell holds this body?
+      size_t slot = 0;                  ///< Where in the cell is this body?
+      Kind kind = Kind::ORG;            ///< Organism or resource?
+      bool active = false;              ///< Is this body on the grid?
+    };
+
+  private:
+
+    double world_x;                     ///< Size of the world
+    double world_y;
+    double cell_w;                      ///< Size of each cell (cells tile the world exactly)
+    double cell_h;
+    size_t cols;                        ///< Number of cells per axis
+    size_t rows;
+    double max_radius;                  ///< Largest radius put on the grid so far
+
+    emp::vector<emp::vector<size_t>> cells;     ///< Surface ids held in each cell
+    emp::vector<Body> bodies;                   ///< Every body, indexed by surface id
+    emp::vector<size_t> open_ids;               ///< Surface ids free to be reused
+
+
+    /* Helper functions */
+
+    double Wrap(double v, double max) const                       ///< Wrap a coordinate into [0, max)
+    {
+      if(v < 0.0 || v >= max) { v = std::fmod(v, max); if(v < 0.0) v += max; }
+      return v;
+    }
+    size_t CellOf(double x, double y) const;                      ///< Which cell holds a point?
+    void AddToCell(size_t sid, size_t cell);                      ///< Link surface id into a cell
+    void RemoveFromCell(size_t sid);                              ///< Unlink surface id from its cell
+
+    ///< Call fun(cell) for every cell r rings out from (cx0, cy0), each cell of the torus at most once overall.
+    template <typename FUN_T>
+    void ForEachCellInRing(size_t cx0, size_t cy0, size_t r, FUN_T && fun) const;
+
+    ///< Visit bodies ring by ring out from p; stop once no further body can beat bound() (a squared distance).
+    template <typename VISIT_T, typename BOUND_T>
+    void RingSearch(const emp::Point & p, double max_dist, VISIT_T && visit, BOUND_T && bound) const;
+
+  public:
+
+    /* Constructors */
+
+    SpatialGrid(double _world_x, double _world_y, double _max_radius);
+
+
+    /* Functions dedicated to maintaining the grid */
+
+    size_t AddBody(Kind kind, size_t owner, const emp::Point & center, double radius);   ///< Returns surface id
+    void RemoveBody(size_t sid);
+    void Move(size_t sid, const emp::Point & center);
+    void Park(size_t sid);                                        ///< Take a body off the grid but keep its id
+    void Place(size_t sid, const emp::Point & center);            ///< Put a (parked) body back on the grid at center
+    void SetOwner(size_t sid, size_t owner) { emp_assert(sid < bodies.size(), sid); bodies[sid].owner = owner; }
+
+
+    /* Getter functions */
+
+    const Body & GetBody(size_t sid) const { emp_assert(sid < bodies.size(), sid); return bodies[sid]; }
+    size_t GetNumBodies() const { return bodies.size(); }
+    emp::Point WrapPoint(const emp::Point & p) const { return emp::Point(Wrap(p.GetX(), world_x), Wrap(p.GetY(), world_y)); }
+    size_t GetCols() const { return cols; }
+    size_t GetRows() const { return rows; }
+    emp::Point Offset(const emp::Point & from, const Body & to) const;     ///< Shortest (wrapped) step from a point to a body
+    double Dist2(const emp::Point & from, const Body & to) const { const emp::Point d = Offset(from, to); return d.GetX() * d.GetX() + d.GetY() * d.GetY(); }
+
+
+    /* Functions dedicated to queries */
+
+    ///< Call fun(sid) for every other body that overlaps body sid, respecting wrap at the borders.
+    template <typename FUN_T>
+    void ForEachOverlap(size_t sid, FUN_T && fun) const;
+
+    ///< Call fun(sid, dist2) for every body whose center lies within radius of p.
+    template <typename FUN_T>
+    void ForEachInRadius(const emp::Point & p, double radius, FUN_T && fun) const;
+
+    ///< The k nearest bodies to p (centers within max_dist) that pass keep(sid), as (dist2, sid) nearest first.
+    template <typename KEEP_T>
+    void KNearest(const emp::Point & p, size_t k, double max_dist, KEEP_T && keep, emp::vector<std::pair<double, size_t>> & out) const;
+
+    ///< The nearest body to p (center within max_dist) that passes keep(sid); NONE if there is none.
+    template <typename KEEP_T>
+    size_t Nearest(const emp::Point & p, double max_dist, KEEP_T && keep, double & dist2) const;
+
+    static constexpr size_t NONE = (size_t) -1;
+
+
+    /* Functions dedicated to checkpoints */
+
+    void Save(CheckpointWriter & out) const;      ///< Cell order is saved too, so overlaps come back in the same order
+    void Load(CheckpointReader & in);
+};
+
+
+/* Constructors */
+
+SpatialGrid::SpatialGrid(double _world_x, double _world_y, double _max_radius)
+  : world_x(_world_x), world_y(_world_y), max_radius(_max_radius)
+{
+  emp_assert(world_x > 0.0 && world_y > 0.0);
+  emp_assert(max_radius > 0.0, max_radius);
+
+  // Two bodies can only overlap if their centers are within 2*max_radius, so any
+  // overlap is found in the neighbouring cells.
+  const double span = 2.0 * max_radius;
+  cols = std::max<size_t>(1, (size_t) (world_x / span));
+  rows = std::max<size_t>(1, (size_t) (world_y / span));
+  cell_w = world_x / (double) cols;
+  cell_h = world_y / (double) rows;
+  cells.resize(cols * rows);
+}
+
+
+/* Helper functions */
+
+size_t SpatialGrid::CellOf(double x, double y) const
+{
+  const size_t cx = std::min(cols - 1, (size_t) (Wrap(x, world_x) / cell_w));
+  const size_t cy = std::min(rows - 1, (size_t) (Wrap(y, world_y) / cell_h));
+  return cy * cols + cx;
+}
+
+void SpatialGrid::AddToCell(size_t sid, size_t cell)
+{
+  bodies[sid].cell = cell;
+  bodies[sid].slot = cells[cell].size();
+  cells[cell].push_back(sid);
+}
+
+void SpatialGrid::RemoveFromCell(size_t sid)
+{
+  // Swap the last id of the cell into this slot.
+  emp::vector<size_t> & cell = cells[bodies[sid].cell];
+  const size_t slot = bodies[sid].slot;
+  cell[slot] = cell.back();
+  bodies[cell[slot]].slot = slot;
+  cell.pop_back();
+}
+
+
+template <typename FUN_T>
+void SpatialGrid::ForEachCellInRing(size_t cx0, size_t cy0, size_t r, FUN_T && fun) const
+{
+  // Offsets are clamped to one lap of the torus, so wrapped cells are not visited twice.
+  const long R = (long) r;
+  const long lo_x = -(long) std::min(r, (cols - 1) / 2), hi_x = (long) std::min(r, cols / 2);
+  const long lo_y = -(long) std::min(r, (rows - 1) / 2), hi_y = (long) std::min(r, rows / 2);
+  auto col = [&](long i) { return (size_t) (((long) cx0 + i + (long) cols) % (long) cols); };
+  for(long j = lo_y; j <= hi_y; ++j)
+  {
+    const size_t row = (size_t) (((long) cy0 + j + (long) rows) % (long) rows) * cols;
+    if(j == -R || j == R)
+    {
+      for(long i = lo_x; i <= hi_x; ++i) { fun(row + col(i)); }
+    }
+    else
+    {
+      if(-R >= lo_x) { fun(row + col(-R)); }
+      if(R <= hi_x && R != 0) { fun(row + col(R)); }
+    }
+  }
+}
+
+template <typename VISIT_T, typename BOUND_T>
+void SpatialGrid::RingSearch(const emp::Point & p, double max_dist, VISIT_T && visit, BOUND_T && bound) const
+{
+  const size_t cell = CellOf(p.GetX(), p.GetY());
+  const size_t cx0 = cell % cols;
+  const size_t cy0 = cell / cols;
+  const double max_d2 = max_dist * max_dist;
+  const double step = std::min(cell_w, cell_h);
+  const size_t max_ring = std::max(cols, rows) / 2;     ///< Covers the whole torus
+
+  for(size_t r = 0; r <= max_ring; ++r)
+  {
+    ForEachCellInRing(cx0, cy0, r, [&](size_t c)
+    {
+      for(size_t sid : cells[c])
+      {
+        const double d2 = Dist2(p, bodies[sid]);
+        if(d2 <= max_d2) { visit(sid, d2); }
+      }
+    });
+
+    // Every body in a later ring is at least r cells away.
+    const double reach = r * step;
+    if(reach > max_dist || reach * reach >= bound()) { break; }
+  }
+}
+
+
+/* Functions dedicated to maintaining the grid */
+
+size_t SpatialGrid::AddBody(Kind kind, size_t owner, const emp::Point & center, double radius)
+{
+  // Reuse the id of a removed body if we can.
+  size_t sid = bodies.size();
+  if(open_ids.size()) { sid = open_ids.back(); open_ids.pop_back(); }
+  else { bodies.resize(sid + 1); }
+  emp_assert(bodies[sid].active == false, sid);
+
+  Body & body = bodies[sid];
+  body.x = Wrap(center.GetX(), world_x);
+  body.y = Wrap(center.GetY(), world_y);
+  body.radius = radius;
+  body.owner = owner;
+  body.kind = kind;
+  body.active = true;
+  max_radius = std::max(max_radius, radius);
+
+  AddToCell(sid, CellOf(body.x, body.y));
+  return sid;
+}
+
+void SpatialGrid::RemoveBody(size_t sid)
+{
+  emp_assert(sid < bodies.size(), sid);
+  if(bodies[sid].active == false) { return; }
+
+  RemoveFromCell(sid);
+  bodies[sid].active = false;
+  open_ids.push_back(sid);
+}
+
+void SpatialGrid::Move(size_t sid, const emp::Point & center)
+{
+  emp_assert(sid < bodies.size(), sid);
+  emp_assert(bodies[sid].active, sid);
+
+  Body & body = bodies[sid];
+  body.x = Wrap(center.GetX(), world_x);
+  body.y = Wrap(center.GetY(), world_y);
+
+  // Only touch the cell vectors if the body crossed into a new cell.
+  const size_t cell = CellOf(body.x, body.y);
+  if(cell != body.cell)
+  {
+    RemoveFromCell(sid);
+    AddToCell(sid, cell);
+  }
+}
+
+void SpatialGrid::Park(size_t sid)
+{
+  emp_assert(sid < bodies.size(), sid);
+  if(bodies[sid].active == false) { return; }
+
+  // Unlike RemoveBody, the id is not handed out again.
+  RemoveFromCell(sid);
+  bodies[sid].active = false;
+}
+
+void SpatialGrid::Place(size_t sid, const emp::Point & center)
+{
+  emp_assert(sid < bodies.size(), sid);
+  if(bodies[sid].active) { Move(sid, center); return; }
+
+  Body & body = bodies[sid];
+  body.x = Wrap(center.GetX(), world_x);
+  body.y = Wrap(center.GetY(), world_y);
+  body.active = true;
+  AddToCell(sid, CellOf(body.x, body.y));
+}
+
+
+/* Getter functions */
+
+emp::Point SpatialGrid::Offset(const emp::Point & from, const Body & to) const
+{
+  double dx = to.x - Wrap(from.GetX(), world_x);
+  double dy = to.y - Wrap(from.GetY(), world_y);
+  if(dx > world_x / 2.0) { dx -= world_x; } else if(dx < -world_x / 2.0) { dx += world_x; }
+  if(dy > world_y / 2.0) { dy -= world_y; } else if(dy < -world_y / 2.0) { dy += world_y; }
+  return emp::Point(dx, dy);
+}
+
+
+/* Functions dedicated to queries */
+
+template <typename FUN_T>
+void SpatialGrid::ForEachOverlap(size_t sid, FUN_T && fun) const
+{
+  emp_assert(sid < bodies.size(), sid);
+  const Body & body = bodies[sid];
+  if(body.active == false) { return; }
+
+  // How many cells out do we need to look?  (Normally just the 3x3 block.)
+  const size_t span_x = (size_t) std::ceil((body.radius + max_radius) / cell_w);
+  const size_t span_y = (size_t) std::ceil((body.radius + max_radius) / cell_h);
+  const size_t num_x = std::min(cols, 2 * span_x + 1);
+  const size_t num_y = std::min(rows, 2 * span_y + 1);
+
+  // Start at the lower-left neighbour and wrap around the borders.
+  const size_t cx0 = body.cell % cols;
+  const size_t cy0 = body.cell / cols;
+  const size_t start_x = (cx0 + cols - (span_x % cols)) % cols;
+  const size_t start_y = (cy0 + rows - (span_y % rows)) % rows;
+  const double half_x = world_x / 2.0;
+  const double half_y = world_y / 2.0;
+
+  for(size_t j = 0; j < num_y; ++j)
+  {
+    const size_t cy = (start_y + j) % rows;
+    for(size_t i = 0; i < num_x; ++i)
+    {
+      const size_t cx = (start_x + i) % cols;
+      for(size_t other_id : cells[cy * cols + cx])
+      {
+        if(other_id == sid) { continue; }
+        const Body & other = bodies[other_id];
+
+        // Shortest distance across the wrapped borders.
+        double dx = std::abs(body.x - other.x);
+        double dy = std::abs(body.y - other.y);
+        if(dx > half_x) { dx = world_x - dx; }
+        if(dy > half_y) { dy = world_y - dy; }
+
+        const double rad_sum = body.radius + other.radius;
+        if(dx * dx + dy * dy < rad_sum * rad_sum) { fun(other_id); }
+      }
+    }
+  }
+}
+
+
+template <typename FUN_T>
+void SpatialGrid::ForEachInRadius(const emp::Point & p, double radius, FUN_T && fun) const
+{
+  const double r2 = radius * radius;
+  const size_t span_x = (size_t) std::ceil(radius / cell_w);
+  const size_t span_y = (size_t) std::ceil(radius / cell_h);
+  const size_t num_x = std::min(cols, 2 * span_x + 1);
+  const size_t num_y = std::min(rows, 2 * span_y + 1);
+
+  const size_t cell = CellOf(p.GetX(), p.GetY());
+  const size_t start_x = (cell % cols + cols - (span_x % cols)) % cols;
+  const size_t start_y = (cell / cols + rows - (span_y % rows)) % rows;
+
+  for(size_t j = 0; j < num_y; ++j)
+  {
+    const size_t cy = (start_y + j) % rows;
+    for(size_t i = 0; i < num_x; ++i)
+    {
+      for(size_t sid : cells[cy * cols + (start_x + i) % cols])
+      {
+        const double d2 = Dist2(p, bodies[sid]);
+        if(d2 <= r2) { fun(sid, d2); }
+      }
+    }
+  }
+}
+
+template <typename KEEP_T>
+void SpatialGrid::KNearest(const emp::Point & p, size_t k, double max_dist, KEEP_T && keep,
+                           emp::vector<std::pair<double, size_t>> & out) const
+{
+  out.clear();
+  if(k == 0) { return; }
+
+  // out is a max-heap on distance while searching, so the worst of the k is at the front.
+  RingSearch(p, max_dist,
+    [&](size_t sid, double d2)
+    {
+      if(!keep(sid)) { return; }
+      if(out.size() < k) { out.emplace_back(d2, sid); std::push_heap(out.begin(), out.end()); }
+      else if(d2 < out.front().first)
+      {
+        std::pop_heap(out.begin(), out.end());
+        out.back() = std::make_pair(d2, sid);
+        std::push_heap(out.begin(), out.end());
+      }
+    },
+    [&]() { return (out.size() < k) ? std::numeric_limits<double>::infinity() : out.front().first; });
+  std::sort_heap(out.begin(), out.end());
+}
+
+template <typename KEEP_T>
+size_t SpatialGrid::Nearest(const emp::Point & p, double max_dist, KEEP_T && keep, double & dist2) const
+{
+  size_t best = NONE;
+  dist2 = std::numeric_limits<double>::infinity();
+  RingSearch(p, max_dist,
+    [&](size_t sid, double d2) { if((d2 < dist2 || (d2 == dist2 && sid < best)) && keep(sid)) { best = sid; dist2 = d2; } },
+    [&]() { return dist2; });
+  return best;
+}
+
+
+/* Functions dedicated to checkpoints */
+
+void SpatialGrid::Save(CheckpointWriter & out) const
+{
+  out.Write(max_radius);
+  out.WriteVector(bodies);
+  out.WriteVector(open_ids);
+  out.Write<uint64_t>(cells.size());
+  for(const emp::vector<size_t> & cell : cells) { out.WriteVector(cell); }
+}
+
+void SpatialGrid::Load(CheckpointReader & in)
+{
+  max_radius = in.Read<double>();
+  in.ReadVector(bodies);
+  in.ReadVector(open_ids);
+  const uint64_t num_cells = in.Read<uint64_t>();
+  if(num_cells != cells.size())
+  {
+    std::cerr << "ERROR: Checkpoint grid has " << num_cells << " cells, expected " << cells.size() << std::endl;
+    exit(-1);
+  }
+  for(emp::vector<size_t> & cell : cells) { in.ReadVector(cell); }
+}
+
+#endif
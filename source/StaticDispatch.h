@@ -0,0 +1,150 @@
+/// This is a SignalGP execution loop with the BeakerWorld instruction set compiled into a switch (built with BEAKER_STATIC_DISPATCH).
+
+#ifndef STATIC_DISPATCH_H
+#define STATIC_DISPATCH_H
+
+///< Includes from Empirical
+#include "base/assert.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+
+///< Standard C++ includes
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+
+/// The instruction library calls every instruction through a std::function.  When the instruction set
+/// is fixed, the opcode can index a dense switch instead (a jump table), and every instruction becomes a
+/// direct call the compiler can inline.  SingleProcess mirrors EventDrivenGP::SingleProcess step for step;
+/// only the instruction call differs, so both modes run programs identically.
+
+namespace static_dispatch
+{
+  ///< Instructions SignalGP provides, in the order ConfigInst registers them.
+  #define BEAKER_STD_OPS(X) X(Inc) X(Dec) X(Not) X(Add) X(Sub) X(Mult) X(Div) X(Mod) X(TestEqu) X(TestNEqu) \
+                            X(TestLess) X(Call) X(Return) X(SetMem) X(CopyMem) X(SwapMem) X(Input) X(Output)  \
+                            X(Commit) X(Pull) X(Nop) X(Fork) X(Terminate) X(If) X(While) X(Countdown)        \
+                            X(Close) X(Break)
+  ///< Instructions the world provides (WORLD_T::Inst_<name>), registered after the SignalGP ones.
+  #define BEAKER_WORLD_OPS(X) X(Vroom) X(SpinRight) X(SpinLeft) X(Consume) \
+                              X(SenseRes) X(SenseLarger) X(SenseSmaller) X(SenseDensity)
+
+  enum class Op : uint8_t
+  {
+    #define BEAKER_OP_ENUM(name) name,
+    BEAKER_STD_OPS(BEAKER_OP_ENUM) BEAKER_WORLD_OPS(BEAKER_OP_ENUM)
+    #undef BEAKER_OP_ENUM
+    NUM_OPS
+  };
+
+  constexpr const char * OP_NAMES[] =
+  {
+    #define BEAKER_OP_NAME(name) #name,
+    BEAKER_STD_OPS(BEAKER_OP_NAME) BEAKER_WORLD_OPS(BEAKER_OP_NAME)
+    #undef BEAKER_OP_NAME
+  };
+
+  ///< Instruction ids are positions in the library, so they must line up with Op.
+  template <typename INST_LIB_T>
+  void CheckOrder(const INST_LIB_T & inst_lib)
+  {
+    for(size_t op = 0; op < (size_t) Op::NUM_OPS; ++op)
+    {
+      if(inst_lib.GetID(OP_NAMES[op]) != op)
+      {
+        std::cerr << "ERROR: Instruction " << OP_NAMES[op] << " is not registered as opcode " << op << std::endl;
+        exit(-1);
+      }
+    }
+  }
+
+  template <typename HARDWARE_T, typename WORLD_T>
+  inline void Execute(HARDWARE_T & hw, const typename HARDWARE_T::inst_t & inst, WORLD_T & world)
+  {
+    switch((Op) inst.id)
+    {
+      #define BEAKER_OP_STD_CASE(name) case Op::name: HARDWARE_T::Inst_##name(hw, inst); break;
+      BEAKER_STD_OPS(BEAKER_OP_STD_CASE)
+      #undef BEAKER_OP_STD_CASE
+      #define BEAKER_OP_WORLD_CASE(name) case Op::name: world.Inst_##name(hw, inst); break;
+      BEAKER_WORLD_OPS(BEAKER_OP_WORLD_CASE)
+      #undef BEAKER_OP_WORLD_CASE
+      default: emp_assert(false, inst.id); break;
+    }
+  }
+
+  ///< One clock cycle: handle queued events, then run one instruction on every active core.
+  template <typename HARDWARE_T, typename WORLD_T>
+  void SingleProcess(HARDWARE_T & hw, WORLD_T & world)
+  {
+    using access_t = checkpoint::HardwareAccess<HARDWARE_T>;
+    auto & event_queue = hw.*access_t::EventQueue();
+    auto & cores = hw.*access_t::Cores();
+    auto & active_cores = hw.*access_t::ActiveCores();
+    auto & inactive_cores = hw.*access_t::InactiveCores();
+    auto & pending_cores = hw.*access_t::PendingCores();
+    auto & exec_core_id = hw.*access_t::ExecCoreID();
+    auto & is_executing = hw.*access_t::IsExecuting();
+    const auto & program = hw.GetProgram();
+    emp_assert(program.GetSize());
+
+    // Handle events (which may spawn new cores).
+    while(!event_queue.empty())
+    {
+      hw.HandleEvent(event_queue.front());
+      event_queue.pop_front();
+    }
+
+    // Give every active core one instruction; finished cores are squeezed out as we go.
+    const size_t core_cnt = active_cores.size();
+    size_t adjust = 0;
+    is_executing = true;
+    for(size_t idx = 0; idx < core_cnt; ++idx)
+    {
+      exec_core_id = active_cores[idx];
+      if(adjust)
+      {
+        active_cores[idx - adjust] = exec_core_id;
+        active_cores[idx] = (size_t) -1;
+      }
+
+      const size_t ip = cores[exec_core_id].back().inst_ptr;
+      const size_t fp = cores[exec_core_id].back().func_ptr;
+      if(program.ValidPosition(fp, ip))
+      {
+        cores[exec_core_id].back().inst_ptr += 1;
+        Execute(hw, program[fp].inst_seq[ip], world);
+      }
+      else if(ip >= program[fp].GetSize())
+      {
+        hw.ReturnFunction();
+      }
+
+      if(cores[exec_core_id].empty())
+      {
+        active_cores[idx - adjust] = (size_t) -1;
+        inactive_cores.emplace_back(exec_core_id);
+        ++adjust;
+      }
+    }
+    is_executing = false;
+
+    // Drop finished cores and start the ones spawned during this cycle.
+    active_cores.resize(core_cnt - adjust);
+    while(pending_cores.size())
+    {
+      active_cores.emplace_back(pending_cores.front());
+      pending_cores.pop_front();
+    }
+    if(active_cores.size()) { exec_core_id = active_cores[0]; }
+  }
+
+  template <typename HARDWARE_T, typename WORLD_T>
+  void Process(HARDWARE_T & hw, size_t num_inst, WORLD_T & world)
+  {
+    for(size_t i = 0; i < num_inst; ++i) { SingleProcess(hw, world); }
+  }
+}
+
+#endif
@@ -0,0 +1,217 @@
+/// This is a streaming recorder that writes rows of world statistics as column blocks on a background thread.
+
+#ifndef STATS_RECORDER_H
+#define STATS_RECORDER_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Standard C++ includes
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+
+/// File layout: magic, column count, the column names (length + chars), then blocks.  Each block is
+/// its row count followed by every column's values for those rows back to back (all doubles).
+
+class StatsRecorder
+{
+  public:
+
+    static constexpr uint32_t MAGIC = 0x53544257;        ///< "WBTS"
+
+  private:
+
+    struct Block
+    {
+      emp::vector<double> data;         ///< Column major: data[col * block_rows + row]
+      size_t rows = 0;
+    };
+
+    emp::vector<std::string> columns;   ///< Column names
+    size_t block_rows;                  ///< Rows per block
+    std::ofstream bin;                  ///< Columnar output
+    std::ofstream csv;                  ///< Optional row-per-line copy
+
+    Block cur;                          ///< Block being filled by the update loop
+    emp::vector<Block> full;            ///< Blocks waiting for the writer thread
+    emp::vector<Block> spare;           ///< Written blocks kept around for reuse
+    std::mutex mtx;                     ///< Guards full, spare and stop
+    std::condition_variable cv;         ///< Wakes the writer thread
+    std::condition_variable idle;       ///< Wakes Flush once the writer has caught up
+    bool stop = false;
+    bool busy = false;                  ///< Is the writer thread writing blocks it took?
+    std::thread writer;                 ///< Does all the disk work
+
+    void WriterLoop();
+    void WriteBlock(const Block & block);
+    void Submit();                      ///< Hand the current block to the writer thread
+
+  public:
+
+    /* Constructors, Destructors */
+
+    ///< With append, rows go after those already in the files (a resumed run) and no header is written.
+    StatsRecorder(const std::string & bin_path, const std::string & csv_path,
+                  const emp::vector<std::string> & _columns, size_t _block_rows=256, bool append=false);
+    ~StatsRecorder();
+
+    StatsRecorder(const StatsRecorder &) = delete;
+    StatsRecorder & operator=(const StatsRecorder &) = delete;
+
+
+    /* Getter functions */
+
+    size_t GetNumColumns() const { return columns.size(); }
+    bool Good() const { return bin.good(); }
+
+
+    /* Functions dedicated to recording */
+
+    void AddRow(const emp::vector<double> & row);         ///< Never touches the disk
+    void Flush();                                         ///< Hand over a partly filled block and wait until all rows are written
+};
+
+
+/* Constructors, Destructors */
+
+StatsRecorder::StatsRecorder(const std::string & bin_path, const std::string & csv_path,
+                             const emp::vector<std::string> & _columns, size_t _block_rows, bool append)
+  : columns(_columns), block_rows(_block_rows), bin(bin_path, append ? std::ios::binary | std::ios::app : std::ios::binary)
+{
+  emp_assert(block_rows > 0);
+  if(!bin.is_open())
+  {
+    std::cerr << "ERROR: Could not open stats file " << bin_path << std::endl;
+    exit(-1);
+  }
+  cur.data.resize(columns.size() * block_rows);
+
+  // Header
+  const uint32_t num_cols = columns.size();
+  if(!append)
+  {
+    bin.write(reinterpret_cast<const char *>(&MAGIC), sizeof(MAGIC));
+    bin.write(reinterpret_cast<const char *>(&num_cols), sizeof(num_cols));
+    for(const std::string & name : columns)
+    {
+      const uint32_t len = name.size();
+      bin.write(reinterpret_cast<const char *>(&len), sizeof(len));
+      bin.write(name.data(), len);
+    }
+  }
+
+  if(csv_path != "")
+  {
+    csv.open(csv_path, append ? std::ios::app : std::ios::out);
+    if(!csv.is_open())
+    {
+      std::cerr << "ERROR: Could not open stats file " << csv_path << std::endl;
+      exit(-1);
+    }
+    csv << std::setprecision(10);
+    if(!append)
+    {
+      for(size_t c = 0; c < columns.size(); ++c) { csv << (c ? "," : "") << columns[c]; }
+      csv << "\n";
+    }
+  }
+
+  writer = std::thread([this]() { WriterLoop(); });
+}
+
+StatsRecorder::~StatsRecorder()
+{
+  Flush();
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    stop = true;
+  }
+  cv.notify_one();
+  writer.join();
+}
+
+
+/* Functions dedicated to recording */
+
+void StatsRecorder::AddRow(const emp::vector<double> & row)
+{
+  emp_assert(row.size() == columns.size(), row.size(), columns.size());
+  for(size_t c = 0; c < columns.size(); ++c) { cur.data[c * block_rows + cur.rows] = row[c]; }
+  if(++cur.rows == block_rows) { Submit(); }
+}
+
+void StatsRecorder::Flush()
+{
+  if(cur.rows) { Submit(); }
+
+  // Checkpoints rely on every row recorded so far being on disk.
+  std::unique_lock<std::mutex> lock(mtx);
+  idle.wait(lock, [this]() { return full.empty() && !busy; });
+}
+
+void StatsRecorder::Submit()
+{
+  std::lock_guard<std::mutex> lock(mtx);
+  full.push_back(std::move(cur));
+
+  // Reuse a written block if there is one.
+  if(spare.size()) { cur = std::move(spare.back()); spare.pop_back(); }
+  else { cur = Block(); cur.data.resize(columns.size() * block_rows); }
+  cur.rows = 0;
+  cv.notify_one();
+}
+
+void StatsRecorder::WriterLoop()
+{
+  emp::vector<Block> todo;
+  while(true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      cv.wait(lock, [this]() { return stop || full.size(); });
+      if(full.empty() && stop) { return; }
+      todo.swap(full);
+      busy = true;
+    }
+
+    for(const Block & block : todo) { WriteBlock(block); }
+    bin.flush();
+    if(csv.is_open()) { csv.flush(); }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for(Block & block : todo) { spare.push_back(std::move(block)); }
+    todo.clear();
+    busy = false;
+    idle.notify_all();
+  }
+}
+
+void StatsRecorder::WriteBlock(const Block & block)
+{
+  // Only the filled part of each column goes out.
+  const uint32_t rows = block.rows;
+  bin.write(reinterpret_cast<const char *>(&rows), sizeof(rows));
+  for(size_t c = 0; c < columns.size(); ++c)
+  {
+    bin.write(reinterpret_cast<const char *>(block.data.data() + c * block_rows), sizeof(double) * rows);
+  }
+
+  if(csv.is_open())
+  {
+    for(size_t r = 0; r < rows; ++r)
+    {
+      for(size_t c = 0; c < columns.size(); ++c) { csv << (c ? "," : "") << block.data[c * block_rows + r]; }
+      csv << "\n";
+    }
+  }
+}
+
+#endif
@@ -4,6 +4,7 @@
 // Standard includes
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 // Empirical includes
 #include "web/Animate.h"
@@ -65,11 +66,11 @@ class WebInterface : public UI::Animate
                     return world.GetNumOrgs();
                 }
             )
-            << " | id_map Size: "
+            << " | Pop Slots: "
             << UI::Live(
                 [this]()
                 {
-                    return world.GetIDSize();
+                    return world.GetPopSize();
                 }
             )
             << " | # of Deaths: "
@@ -87,6 +88,37 @@ class WebInterface : public UI::Animate
                 }
             )
             << "<br>" 
+            << "Mean Radius: " << UI::Live(
+                [this]()
+                {
+                    return world.Precision(world.GetStats().GetRadiusMean());
+                }
+            )
+            << " | Mean Energy: " << UI::Live(
+                [this]()
+                {
+                    return world.Precision(world.GetStats().GetEnergyMean());
+                }
+            )
+            << " | Births/Deaths (last update): " << UI::Live(
+                [this]()
+                {
+                    return std::to_string(world.GetStats().GetUpdateBirths()) + "/" + std::to_string(world.GetStats().GetUpdateDeaths());
+                }
+            )
+            << " | Resources: " << UI::Live(
+                [this]()
+                {
+                    return std::to_string(world.GetResources().GetNumAlive());
+                }
+            )
+            << " | Genotypes: " << UI::Live(
+                [this]()
+                {
+                    return std::to_string(world.GetNumGenotypes());
+                }
+            )
+            << "<br>" 
             << "<u>Average Radius</u>:"
             << "<br>" 
             << "Blue: " << UI::Live(
@@ -129,7 +161,7 @@ class WebInterface : public UI::Animate
 
             // Adding the canvas to draw organsisms!
             beaker_viewer << UI::Canvas(config.WORLD_X(), config.WORLD_Y(), "beaker_view");
-            UI::Draw(beaker_viewer.Canvas("beaker_view"), world.GetSurface(), heat_map);
+            DrawBeaker();
 
             emp::JSWrap([this](){return world.GetBlue();}, "GetBlue", false);
             emp::JSWrap([this](){return world.GetCyan();}, "GetCyan", false);
@@ -151,6 +183,7 @@ class WebInterface : public UI::Animate
         void DoFrame();                 ///< Function responsible for drawing a frame *overloaded*
         void Config_HM();               ///< Function dedicated to configuring the heat map
         void RedrawChart();
+        void DrawBeaker();              ///< Function dedicated to drawing the orgs and resources
 };
 
 void WebInterface::Redraw() ///< Function dedicated to redrawing objects on screen
@@ -200,29 +233,70 @@ void WebInterface::DoFrame() ///< Function responsible for drawing a frame *over
     if(GetActive())
     {
         world.Update();
-        UI::Draw(beaker_viewer.Canvas("beaker_view"), world.GetSurface(), heat_map);
+        DrawBeaker();
         WebInterface::Redraw();
     }
 }
 
 void WebInterface::Config_HM() ///< Function dedicated to configuring the heat map
 {
-  // Level 0 heat: Blue
-  heat_map.push_back(emp::ColorRGB(0,0,225));
-  // Level 1 heat: Cyan
-  heat_map.push_back(emp::ColorRGB(0,255,255));
-  // Level 2 heat: Green Yellow
-  heat_map.push_back(emp::ColorRGB(173,255,47));
-  // Level 3 heat: Yellow
-  heat_map.push_back(emp::ColorRGB(255,255,0));
-  // Level 4 heat: Red
-  heat_map.push_back(emp::ColorRGB(255,0,0));
-  // Level 5 heat: White
-  heat_map.push_back(emp::ColorRGB(245,245,255));
-  // Level 6 (resource only: magenta
+  // Heat runs blue, cyan, green yellow, yellow, red, white.  Orgs are binned into HM_SIZE levels, so the
+  // levels are spread over these colors (blending between them); HM_SIZE 6 gets exactly these.
+  const int anchors[][3] = {{0,0,225}, {0,255,255}, {173,255,47}, {255,255,0}, {255,0,0}, {245,245,255}};
+  const size_t last = sizeof(anchors) / sizeof(anchors[0]) - 1;
+  const size_t levels = config.HM_SIZE();
+  for(size_t k = 0; k < levels; ++k)
+  {
+    const double t = (levels > 1) ? (double) (k * last) / (levels - 1) : 0.0;
+    const size_t a = std::min((size_t) t, last - 1);
+    const double f = t - a;
+    auto mix = [&](size_t c) { return (int) (anchors[a][c] + f * (anchors[a + 1][c] - anchors[a][c]) + 0.5); };
+    heat_map.push_back(emp::ColorRGB(mix(0), mix(1), mix(2)));
+  }
+  // Level HM_SIZE (resource only): magenta
   heat_map.push_back(emp::ColorRGB(255,0,255));
 }
 
+void WebInterface::DrawBeaker() ///< Function dedicated to drawing the orgs and resources
+{
+    UI::Canvas canvas = beaker_viewer.Canvas("beaker_view");
+    const SpatialGrid & surface = world.GetSurface();
+    const OrgTable & orgs = world.GetOrgTable();
+
+    canvas.Clear();
+    canvas.Rect(0, 0, config.WORLD_X(), config.WORLD_Y(), "black");
+
+    // A food field is drawn as green cells under the bodies (brighter is fuller).
+    if(world.UseField())
+    {
+        const ResourceField & field = world.GetField();
+        for(size_t row = 0; row < field.GetRows(); ++row)
+        {
+            for(size_t col = 0; col < field.GetCols(); ++col)
+            {
+                const double fill = std::min(1.0, field.Get(col, row) / field.GetCapacity());
+                if(fill <= 0.0) { continue; }
+                canvas.Rect(col * field.GetCellW(), row * field.GetCellH(), field.GetCellW(), field.GetCellH(),
+                            "rgb(0," + std::to_string((int) (fill * 160)) + ",0)");
+            }
+        }
+    }
+
+    // Resources come from the alive mask (only set bits are visited), organisms from the org table.
+    world.GetResources().ForEachAlive([&](size_t mid)
+    {
+        const SpatialGrid::Body & body = surface.GetBody(world.GetResources().GetSurfaceID(mid));
+        canvas.Circle(emp::Point(body.x, body.y), body.radius, heat_map[config.HM_SIZE()], "white");
+    });
+    for(size_t sid = 0; sid < surface.GetNumBodies(); ++sid)
+    {
+        const SpatialGrid::Body & body = surface.GetBody(sid);
+        if(body.active == false || body.kind != SpatialGrid::Kind::ORG) { continue; }
+        if(orgs.IsAlive(body.owner) == false) { continue; }
+        canvas.Circle(orgs.GetCenter(body.owner), orgs.GetRadius(body.owner), heat_map[orgs.GetHeat(body.owner)], "white");
+    }
+}
+
 void WebInterface::RedrawChart()
 {
     EM_ASM({
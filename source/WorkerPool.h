@@ -0,0 +1,144 @@
+/// This is a small pool of worker threads used to run independent per-organism work in parallel.
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Standard C++ includes
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <type_traits>
+
+class WorkerPool
+{
+  private:
+
+    using run_fun_t = void (*)(void *, size_t, size_t);    ///< Runs a job over [begin, end)
+
+    emp::vector<std::thread> workers;     ///< Helper threads (the calling thread also does work)
+    std::mutex mtx;                       ///< Guards everything below
+    std::condition_variable start_cv;     ///< Wakes workers when a job is posted
+    std::condition_variable done_cv;      ///< Wakes the caller when all workers are done
+
+    run_fun_t job_run = nullptr;          ///< Current job (no allocation when posting a job)
+    void * job_ctx = nullptr;
+    size_t job_size = 0;                  ///< Number of items in the current job
+    size_t generation = 0;                ///< Incremented every time a job is posted
+    size_t pending = 0;                   ///< Number of workers still running the job
+    bool stop = false;                    ///< Are we shutting down?
+
+    void WorkerLoop(size_t tid);          ///< Loop every helper thread runs
+    void RunChunk(size_t tid);            ///< Run the contiguous chunk of items owned by thread tid
+
+  public:
+
+    /* Constructors, Destructors */
+
+    WorkerPool(size_t num_threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool & operator=(const WorkerPool &) = delete;
+
+
+    /* Getter functions */
+
+    size_t GetNumThreads() const { return workers.size() + 1; }
+
+
+    /* Functions dedicated to running jobs */
+
+    ///< Call fun(i) for every i in [0, n), splitting the range into one contiguous chunk per thread.
+    ///< Which thread runs which item is fixed, so the caller only has to keep items independent.
+    template <typename FUN_T>
+    void ParallelFor(size_t n, FUN_T && fun);
+};
+
+
+/* Constructors, Destructors */
+
+WorkerPool::WorkerPool(size_t num_threads)
+{
+  for(size_t tid = 1; tid < num_threads; ++tid)
+  {
+    workers.emplace_back([this, tid]() { WorkerLoop(tid); });
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    stop = true;
+  }
+  start_cv.notify_all();
+  for(std::thread & worker : workers) { worker.join(); }
+}
+
+
+/* Functions dedicated to running jobs */
+
+void WorkerPool::WorkerLoop(size_t tid)
+{
+  size_t seen = 0;
+  while(true)
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    start_cv.wait(lock, [this, &seen]() { return stop || generation != seen; });
+    if(stop) { return; }
+    seen = generation;
+    lock.unlock();
+
+    RunChunk(tid);
+
+    lock.lock();
+    if(--pending == 0) { done_cv.notify_one(); }
+  }
+}
+
+void WorkerPool::RunChunk(size_t tid)
+{
+  const size_t num_threads = GetNumThreads();
+  const size_t begin = job_size * tid / num_threads;
+  const size_t end = job_size * (tid + 1) / num_threads;
+  if(begin < end) { job_run(job_ctx, begin, end); }
+}
+
+template <typename FUN_T>
+void WorkerPool::ParallelFor(size_t n, FUN_T && fun)
+{
+  // Nothing to share: just run it here.
+  if(workers.empty() || n < 2)
+  {
+    for(size_t i = 0; i < n; ++i) { fun(i); }
+    return;
+  }
+
+  using fun_t = std::remove_reference_t<FUN_T>;
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    job_run = [](void * ctx, size_t begin, size_t end)
+    {
+      fun_t & job = *static_cast<fun_t *>(ctx);
+      for(size_t i = begin; i < end; ++i) { job(i); }
+    };
+    job_ctx = const_cast<void *>(static_cast<const void *>(std::addressof(fun)));
+    job_size = n;
+    pending = workers.size();
+    ++generation;
+  }
+  start_cv.notify_all();
+
+  // The calling thread takes the first chunk.
+  RunChunk(0);
+
+  std::unique_lock<std::mutex> lock(mtx);
+  done_cv.wait(lock, [this]() { return pending == 0; });
+}
+
+#endif
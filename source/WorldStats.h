@@ -0,0 +1,237 @@
+/// This is a running record of population statistics, updated in O(1) on every birth, death and energy change.
+
+#ifndef WORLD_STATS_H
+#define WORLD_STATS_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Experiment headers
+#include "Checkpoint.h"
+#include "HeatHistogram.h"
+
+///< Standard C++ includes
+#include <algorithm>
+#include <cstdint>
+
+/// Energy moments survive metabolism without a scan: every org loses k * r, so
+///   sum(e) -= k sum(r),  sum(e^2) += -2k sum(r e) + k^2 sum(r^2),  sum(r e) -= k sum(r^2).
+
+class WorldStats
+{
+  public:
+
+    enum class Death {STARVED, EATEN, POPULATION};    ///< Why an org was listed for death
+    enum class Food {RESOURCE, ORG};                  ///< Where energy an org took in came from
+
+    struct Snapshot                                   ///< Everything the interface and stats file show
+    {
+      size_t update = 0;
+      size_t num_orgs = 0;
+      double radius_mean = 0.0, radius_var = 0.0;
+      double energy_mean = 0.0, energy_var = 0.0;
+      size_t births = 0, deaths = 0;                  ///< During the last update
+      size_t total_births = 0, res_eaten = 0;
+      int death_stv = 0, death_eat = 0, death_pop = 0;
+      emp::vector<int> heat_count;                    ///< Per heat bin
+      emp::vector<double> heat_radius;
+      emp::vector<double> res_intake;                 ///< Energy taken in from resources, per heat bin
+      emp::vector<double> org_intake;                 ///< Energy taken in from prey, per heat bin
+    };
+
+  private:
+
+    HeatHistogram heat_hist;            ///< Count and radius moments of each heat signature
+
+    size_t num_orgs = 0;                ///< Orgs on the table
+    double sum_r = 0.0;                 ///< Moments over every live org
+    double sum_r2 = 0.0;
+    double sum_e = 0.0;
+    double sum_e2 = 0.0;
+    double sum_re = 0.0;
+
+    size_t update = 0;                  ///< Update the per-update counters belong to
+    size_t up_births = 0;               ///< Births and deaths during that update
+    size_t up_deaths = 0;
+
+    size_t births = 0;                  ///< Totals over the run
+    size_t res_eaten = 0;
+    int death_stv = 0;
+    int death_eat = 0;
+    int death_pop = 0;
+    emp::vector<double> res_intake;     ///< Energy taken in, per heat bin
+    emp::vector<double> org_intake;
+
+  public:
+
+    /* Constructors */
+
+    WorldStats(size_t num_bins, double min_r, double max_r)
+      : heat_hist(num_bins, min_r, max_r), res_intake(num_bins, 0.0), org_intake(num_bins, 0.0) { ; }
+
+
+    /* Functions dedicated to tracking the population */
+
+    void BeginUpdate(size_t _update) { update = _update; up_births = 0; up_deaths = 0; }
+    void AddOrg(size_t heat, double r, double e);                 ///< An org was put on the table
+    void RemoveOrg(size_t heat, double r, double e);              ///< An org was taken off the table
+    void ChangeEnergy(double r, double old_e, double new_e);      ///< One org's energy changed
+    void Metabolize(double cost_per_radius);                      ///< Every org lost cost_per_radius * r
+    void Feed(size_t heat, double r, double old_e, double new_e, Food food);  ///< Energy change that counts as intake
+
+    void CountBirth() { births++; up_births++; }
+    void CountDeath(Death cause);                                 ///< Counted when an org is listed to die
+    void CountResEaten() { res_eaten++; }
+
+
+    /* Getter functions */
+
+    const HeatHistogram & GetHeatHist() const { return heat_hist; }
+    size_t Bin(double r) const { return heat_hist.Bin(r); }
+    size_t GetNumOrgs() const { return num_orgs; }
+    size_t GetBirths() const { return births; }
+    size_t GetUpdateBirths() const { return up_births; }
+    size_t GetUpdateDeaths() const { return up_deaths; }
+    size_t GetResEaten() const { return res_eaten; }
+    int GetStv() const { return death_stv; }
+    int GetEat() const { return death_eat; }
+    int GetPop() const { return death_pop; }
+    double GetRadiusMean() const { return (num_orgs) ? sum_r / num_orgs : 0.0; }
+    double GetEnergyMean() const { return (num_orgs) ? sum_e / num_orgs : 0.0; }
+    double GetRadiusVar() const { return Var(sum_r, sum_r2); }
+    double GetEnergyVar() const { return Var(sum_e, sum_e2); }
+
+    void Fill(Snapshot & snap) const;                             ///< Reuses the vectors already in snap
+    Snapshot GetSnapshot() const { Snapshot snap; Fill(snap); return snap; }
+
+
+    /* Functions dedicated to checkpoints */
+
+    void Save(CheckpointWriter & out) const;
+    void Load(CheckpointReader & in);
+
+  private:
+
+    double Var(double sum, double sum_sq) const
+    {
+      if(num_orgs == 0) { return 0.0; }
+      const double mean = sum / num_orgs;
+      return std::max(0.0, sum_sq / num_orgs - mean * mean);
+    }
+};
+
+
+/* Functions dedicated to tracking the population */
+
+void WorldStats::AddOrg(size_t heat, double r, double e)
+{
+  heat_hist.Add(heat, r);
+  num_orgs++;
+  sum_r += r; sum_r2 += r * r;
+  sum_e += e; sum_e2 += e * e;
+  sum_re += r * e;
+}
+
+void WorldStats::RemoveOrg(size_t heat, double r, double e)
+{
+  emp_assert(num_orgs > 0);
+  heat_hist.Remove(heat, r);
+  up_deaths++;
+
+  // Start from clean sums once the population is gone, so rounding does not pile up.
+  if(--num_orgs == 0) { sum_r = sum_r2 = sum_e = sum_e2 = sum_re = 0.0; return; }
+  sum_r -= r; sum_r2 -= r * r;
+  sum_e -= e; sum_e2 -= e * e;
+  sum_re -= r * e;
+}
+
+void WorldStats::ChangeEnergy(double r, double old_e, double new_e)
+{
+  sum_e += new_e - old_e;
+  sum_e2 += new_e * new_e - old_e * old_e;
+  sum_re += r * (new_e - old_e);
+}
+
+void WorldStats::Metabolize(double k)
+{
+  sum_e2 += k * (k * sum_r2 - 2.0 * sum_re);
+  sum_e -= k * sum_r;
+  sum_re -= k * sum_r2;
+}
+
+void WorldStats::Feed(size_t heat, double r, double old_e, double new_e, Food food)
+{
+  emp_assert(heat < res_intake.size(), heat);
+  ChangeEnergy(r, old_e, new_e);
+  ((food == Food::RESOURCE) ? res_intake : org_intake)[heat] += new_e - old_e;
+}
+
+void WorldStats::CountDeath(Death cause)
+{
+  if(cause == Death::STARVED) { death_stv++; }
+  else if(cause == Death::EATEN) { death_eat++; }
+  else { death_pop++; }
+}
+
+
+/* Getter functions */
+
+void WorldStats::Fill(Snapshot & snap) const
+{
+  snap.update = update;
+  snap.num_orgs = num_orgs;
+  snap.radius_mean = GetRadiusMean();
+  snap.radius_var = GetRadiusVar();
+  snap.energy_mean = GetEnergyMean();
+  snap.energy_var = GetEnergyVar();
+  snap.births = up_births;
+  snap.deaths = up_deaths;
+  snap.total_births = births;
+  snap.res_eaten = res_eaten;
+  snap.death_stv = death_stv;
+  snap.death_eat = death_eat;
+  snap.death_pop = death_pop;
+
+  const size_t bins = heat_hist.GetNumBins();
+  snap.heat_count.resize(bins);
+  snap.heat_radius.resize(bins);
+  for(size_t h = 0; h < bins; ++h)
+  {
+    snap.heat_count[h] = heat_hist.GetCount(h);
+    snap.heat_radius[h] = heat_hist.GetMean(h);
+  }
+  snap.res_intake = res_intake;
+  snap.org_intake = org_intake;
+}
+
+
+/* Functions dedicated to checkpoints */
+
+void WorldStats::Save(CheckpointWriter & out) const
+{
+  heat_hist.Save(out);
+  out.Write<uint64_t>(num_orgs);
+  out.Write(sum_r); out.Write(sum_r2);
+  out.Write(sum_e); out.Write(sum_e2); out.Write(sum_re);
+  out.Write<uint64_t>(update); out.Write<uint64_t>(up_births); out.Write<uint64_t>(up_deaths);
+  out.Write<uint64_t>(births); out.Write<uint64_t>(res_eaten);
+  out.Write(death_stv); out.Write(death_eat); out.Write(death_pop);
+  out.WriteVector(res_intake);
+  out.WriteVector(org_intake);
+}
+
+void WorldStats::Load(CheckpointReader & in)
+{
+  heat_hist.Load(in);
+  num_orgs = in.Read<uint64_t>();
+  sum_r = in.Read<double>(); sum_r2 = in.Read<double>();
+  sum_e = in.Read<double>(); sum_e2 = in.Read<double>(); sum_re = in.Read<double>();
+  update = in.Read<uint64_t>(); up_births = in.Read<uint64_t>(); up_deaths = in.Read<uint64_t>();
+  births = in.Read<uint64_t>(); res_eaten = in.Read<uint64_t>();
+  death_stv = in.Read<int>(); death_eat = in.Read<int>(); death_pop = in.Read<int>();
+  in.ReadVector(res_intake);
+  in.ReadVector(org_intake);
+}
+
+#endif
@@ -14,11 +14,24 @@ EMP_BUILD_CONFIG( BeakerConfig,
   VALUE(HM_SIZE,        size_t,     6,            "Size of the heat map."),
   VALUE(PROCESS_NUM,    size_t,     7,            "Number of steps an organism runs on update."),
   VALUE(PRED_INJECT,    size_t,     1000,         "Update to inject the preditor org"),
+  VALUE(PRED_INJECT_NUM, size_t,    1,            "How many preditor orgs to inject"),
+  VALUE(PRED_RADIUS,    double,     7.0,          "Radius of the injected preditor orgs"),
+  VALUE(PRED_GENOME,    std::string, "",          "File holding the preditor genome (empty uses the built-in program)"),
+  VALUE(THREAD_NUM,     size_t,     1,            "Number of threads used to run organism brains (1 runs them sequentially)."),
 
   GROUP(RESOURCE, "How are the resouces set up?"),
   VALUE(NUMBER_RESOURCES,     size_t,    500,      "How many sources of resouces should there be?"),
   VALUE(RESOURCE_POWERUP,     double,    300.0,    "Energy gained from eating a resource"),
-  VALUE(RESOURCE_UPS_MAX,      size_t,    100,      "How many sectors are we making (per axis)?" ),
+  VALUE(RESOURCE_UPS_MAX,      size_t,    0,        "How many updates does a resource last before it expires? (0 for never, the old behaviour)" ),
+  VALUE(RESOURCE_RESPAWN_DELAY, size_t,   0,        "How many updates does an eaten or expired resource wait before respawning?"),
+  VALUE(RESOURCE_SPAWN,        int,       0,        "Where do resources spawn? (0 uniform, 1 around fixed patches, 2 near living resources)"),
+  VALUE(RESOURCE_PATCHES,      size_t,    8,        "How many patches resources spawn around (RESOURCE_SPAWN 1)"),
+  VALUE(RESOURCE_PATCH_SIGMA,  double,    20.0,     "Spread of resources around a patch or cluster center"),
+  VALUE(RESOURCE_MODE,         int,       0,        "How is food represented? (0 resource bodies, 1 concentration field)"),
+  VALUE(FIELD_CELL,            double,    10.0,     "Size of a concentration field cell"),
+  VALUE(FIELD_CAPACITY,        double,    300.0,    "Most food a field cell regrows to (also its starting amount)"),
+  VALUE(FIELD_DIFFUSION,       double,    0.05,     "Share of a field cell exchanged with each neighbour per update [0, 0.25]"),
+  VALUE(FIELD_REGROWTH,        double,    0.01,     "Logistic regrowth rate of a field cell per update"),
 
   GROUP(ORGANISM, "How are the organisms set up?"),
   VALUE(INIT_ENERGY,           double,    1000.0,   "How many resources should be in the eviornment?"), 
@@ -35,6 +48,10 @@ EMP_BUILD_CONFIG( BeakerConfig,
   VALUE(REPRODUCTION_PENALTY,  double,    2.0,      "Energy of org is divided by this value"),
   VALUE(CONSUME_RES_THRESH,    double,    0.5,      "Consume resource if radius <= (MAX_CONSUME_RATIO-MIN_CONSUME_RATIO)*CONSUME_RES_THRESH+MIN_CONSUME_RATIO"),
   VALUE(EAT_ORG_ENERGRY_PROP,  double,    0.05,     "Proportion of energry gained from eating a prey org!"),
+  VALUE(SENSE_RANGE,           double,    50.0,     "How far organisms can sense resources and other organisms"),
+  VALUE(SIGNALS,               bool,      false,    "Do world events (collisions, bites, low energy, nearby food) start cores in brains?"),
+  VALUE(SIGNAL_ENERGY_LOW,     double,    0.0,      "Organisms are signalled when their energy drops below this (0 for never)"),
+  VALUE(SIGNAL_RES_RANGE,      double,    0.0,      "Organisms are signalled when a resource comes this close (field: cell half full; 0 for never)"),
 
   GROUP(MUTATIONS, "Various mutation rates for SignalGP Brains"),
   VALUE(POINT_MUTATE_PROB,     double,    0.001,    "Probability of instructions being mutated"),
@@ -59,7 +76,18 @@ EMP_BUILD_CONFIG( BeakerConfig,
 
   GROUP(OUTPUT, "Output rates for BeakerWorld"),
   VALUE(PRINT_INTERVAL,         size_t,     100,      "How many updates between prints?"),
-  VALUE(TESTING,                bool,       true,     "Are we testing/debugging?")
+  VALUE(STATS_FILE,             std::string, "",      "Columnar binary stats file, one row per PRINT_INTERVAL (empty for none)"),
+  VALUE(STATS_CSV,              std::string, "",      "CSV copy of the stats rows (empty for none)"),
+  VALUE(PHYLO_FILE,             std::string, "",      "CSV of the pruned phylogeny, one snapshot per PRINT_INTERVAL (empty for none)"),
+  VALUE(CHECKPOINT_INTERVAL,    size_t,     0,        "How many updates between checkpoints? (0 for never)"),
+  VALUE(CHECKPOINT_FILE,        std::string, "checkpoint", "Prefix of checkpoint files (update number and .bin are added)"),
+  VALUE(RESTORE_FILE,           std::string, "",      "Checkpoint to resume the run from (empty starts a new run)"),
+  VALUE(TESTING,                bool,       true,     "Are we testing/debugging?"),
+
+  GROUP(SWEEP, "Running many replicates at once (native only)"),
+  VALUE(SWEEP_FILE,             std::string, "",      "Sweep file of parameter values to cross and run (empty runs once)"),
+  VALUE(SWEEP_JOBS,             size_t,     0,        "How many replicates run at once? (0 for one per THREAD_NUM cores)"),
+  VALUE(SWEEP_OUTPUT,           std::string, "sweep", "Prefix of the per-run logs and summaries and the aggregated CSV")
 )
 
 #endif
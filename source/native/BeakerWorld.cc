@@ -11,6 +11,7 @@
 #include "../config.h"
 #include "../BeakerWorld.h"
 #include "../ResourceManager.h"
+#include "Runner.h"
 
 int main(int argc, char* argv[])
 {
@@ -20,11 +21,15 @@ int main(int argc, char* argv[])
   if (args.ProcessConfigOptions(config, std::cout, "BeakerWorld.cfg", "BeakerWorld-macros.h") == false) exit(0);
   if (args.TestUnknown() == false) exit(0);  // If there are leftover args, throw an error.
 
-  std::cout << "Begining Run" << std::endl;
-  for(size_t i = 0; i < config.MAX_UPS(); ++i)
+  // A sweep forks one process per replicate; each gets its own copy of the config and world.
+  if(config.SWEEP_FILE() != "")
   {
-    std::cout << "i=" << i << std::endl;
+    SweepRunner sweep(config);
+    sweep.Load(config.SWEEP_FILE());
+    const bool ok = sweep.Run();
+    std::cout << "Finished Sweep: " << config.SWEEP_OUTPUT() << "_summary.csv" << std::endl;
+    return ok ? 0 : 1;
   }
-  std::cout << "Finished Run" << std::endl;
 
+  RunWorld(config, std::cout);
 }
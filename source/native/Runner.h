@@ -0,0 +1,369 @@
+/// This is the native run loop, plus a sweep runner that forks one process per replicate.
+
+#ifndef RUNNER_H
+#define RUNNER_H
+
+///< Includes from Empirical
+#include "base/vector.h"
+#include "base/assert.h"
+
+///< Experiment headers
+#include "../config.h"
+#include "../BeakerWorld.h"
+
+///< Standard C++ includes
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include <map>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/wait.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+/* A single run */
+
+///< Run one world to MAX_UPS; if summary is given, the final state is written to it as key=value lines.
+void RunWorld(BeakerConfig & config, std::ostream & os, std::ostream * summary=nullptr)
+{
+  // Build the world; this injects the initial population and resources.
+  BeakerWorld world(config);
+
+  // Pick up where a previous run left off.
+  if(config.RESTORE_FILE() != "")
+  {
+    world.LoadCheckpoint(config.RESTORE_FILE());
+    os << "Restored " << config.RESTORE_FILE() << " at update " << world.GetUpdate() << std::endl;
+  }
+
+  os << "Begining Run" << std::endl;
+  const auto start = std::chrono::steady_clock::now();
+  const size_t first_update = world.GetUpdate();
+
+  // Run the world as fast as we can, printing a summary every PRINT_INTERVAL updates.
+  while(world.GetUpdate() < config.MAX_UPS())
+  {
+    world.Update();
+    if(config.PRINT_INTERVAL() && world.GetUpdate() % config.PRINT_INTERVAL() == 0)
+    {
+      world.PrintSummary(os);
+      world.RecordStats();
+      world.RecordPhylogeny();
+    }
+    if(config.CHECKPOINT_INTERVAL() && world.GetUpdate() % config.CHECKPOINT_INTERVAL() == 0)
+    {
+      const std::string path = config.CHECKPOINT_FILE() + "_" + std::to_string(world.GetUpdate()) + ".bin";
+      if(!world.SaveCheckpoint(path)) { std::cerr << "ERROR: Could not write checkpoint " << path << std::endl; }
+    }
+  }
+
+  const size_t updates = world.GetUpdate() - first_update;
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  const double ups = (elapsed.count() > 0.0) ? updates / elapsed.count() : 0.0;
+
+  os << "Finished Run" << std::endl;
+  os << "Updates=" << updates << " Seconds=" << elapsed.count()
+     << " Updates/sec=" << ups << std::endl;
+
+  if(summary)
+  {
+    const WorldStats & stats = world.GetStats();
+    std::ostream & out = *summary;
+    out << "update=" << world.GetUpdate() << "\n"
+        << "seconds=" << elapsed.count() << "\n"
+        << "updates_per_sec=" << ups << "\n"
+        << "pop=" << world.GetNumOrgs() << "\n"
+        << "radius_mean=" << stats.GetRadiusMean() << "\n"
+        << "radius_var=" << stats.GetRadiusVar() << "\n"
+        << "energy_mean=" << stats.GetEnergyMean() << "\n"
+        << "energy_var=" << stats.GetEnergyVar() << "\n"
+        << "births=" << stats.GetBirths() << "\n"
+        << "death_stv=" << stats.GetStv() << "\n"
+        << "death_eat=" << stats.GetEat() << "\n"
+        << "death_pop=" << stats.GetPop() << "\n"
+        << "res_eaten=" << stats.GetResEaten() << "\n"
+        << "genotypes=" << world.GetNumGenotypes() << "\n"
+        << "taxa=" << world.GetPhylogeny().GetNumTaxa() << "\n"
+        << "mrca_depth=" << world.GetPhylogeny().GetMRCADepth() << "\n";
+    for(size_t h = 0; h < stats.GetHeatHist().GetNumBins(); ++h)
+    {
+      out << "pop_" << h << "=" << stats.GetHeatHist().GetCount(h) << "\n";
+    }
+  }
+}
+
+
+/* A sweep of runs */
+
+/// Sweep file: one setting per line, '#' starts a comment.
+///   REPLICATES 10                 (runs per grid point, default 1)
+///   RADIUS_MUT 0.001 0.01 0.1     (any config value followed by the values to try)
+/// Every combination of the listed values is a grid point.  Replicate r of a point runs with
+/// SEED + r, so replicates differ while points with the same SEED stay paired.
+
+class SweepRunner
+{
+  private:
+
+    struct Param                                ///< One swept config value
+    {
+      std::string name;
+      emp::vector<std::string> values;
+    };
+
+    BeakerConfig & config;                      ///< Base config; children change their own copy
+    emp::vector<Param> grid;                    ///< Values to sweep
+    size_t replicates = 1;                      ///< Runs per grid point
+    emp::vector<int> cores;                     ///< CPUs this process may run on
+    emp::vector<bool> finished;                 ///< Did each run exit cleanly (this sweep)?
+
+    void SetRun(size_t run);                    ///< Put run's settings into the config
+    void Pin(size_t slot);                      ///< Keep the calling process on slot's cores
+    void RunChild(size_t run, size_t slot);     ///< Never returns
+    std::string RunPath(size_t run, const std::string & ext) const
+    {
+      return config.SWEEP_OUTPUT() + "_" + std::to_string(run) + ext;
+    }
+
+  public:
+
+    /* Constructors */
+
+    SweepRunner(BeakerConfig & _config);
+
+
+    /* Getter functions */
+
+    size_t GetNumPoints() const;
+    size_t GetNumRuns() const { return GetNumPoints() * replicates; }
+    size_t GetNumJobs() const;
+
+
+    /* Functions dedicated to running the sweep */
+
+    void Load(const std::string & path);        ///< Read a sweep file
+    bool Run();                                 ///< Run everything; false if any run failed
+    void Aggregate(std::ostream & os) const;    ///< Collect the summaries of runs that finished cleanly into one CSV
+};
+
+
+/* Constructors */
+
+SweepRunner::SweepRunner(BeakerConfig & _config) : config(_config)
+{
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if(sched_getaffinity(0, sizeof(set), &set) == 0)
+  {
+    for(int c = 0; c < CPU_SETSIZE; ++c) { if(CPU_ISSET(c, &set)) { cores.push_back(c); } }
+  }
+#endif
+  if(cores.empty())
+  {
+    const long n = sysconf(_SC_NPROCESSORS_ONLN);
+    for(long c = 0; c < std::max(1L, n); ++c) { cores.push_back((int) c); }
+  }
+}
+
+
+/* Getter functions */
+
+size_t SweepRunner::GetNumPoints() const
+{
+  size_t points = 1;
+  for(const Param & param : grid) { points *= param.values.size(); }
+  return points;
+}
+
+size_t SweepRunner::GetNumJobs() const
+{
+  if(config.SWEEP_JOBS()) { return config.SWEEP_JOBS(); }
+  return std::max<size_t>(1, cores.size() / std::max<size_t>(1, config.THREAD_NUM()));
+}
+
+
+/* Functions dedicated to running the sweep */
+
+void SweepRunner::Load(const std::string & path)
+{
+  std::ifstream is(path);
+  if(!is.is_open())
+  {
+    std::cerr << "ERROR: Could not open sweep file " << path << std::endl;
+    exit(-1);
+  }
+
+  std::string line;
+  while(std::getline(is, line))
+  {
+    line = line.substr(0, line.find('#'));
+    std::istringstream words(line);
+    Param param;
+    if(!(words >> param.name)) { continue; }
+    for(std::string value; words >> value; ) { param.values.push_back(value); }
+
+    if(param.values.empty())
+    {
+      std::cerr << "ERROR: " << param.name << " has no values in sweep file " << path << std::endl;
+      exit(-1);
+    }
+    if(param.name == "REPLICATES") { replicates = std::max<size_t>(1, std::stoul(param.values[0])); continue; }
+    if(!config.Has(param.name))
+    {
+      std::cerr << "ERROR: Unknown setting " << param.name << " in sweep file " << path << std::endl;
+      exit(-1);
+    }
+    grid.push_back(param);
+  }
+}
+
+void SweepRunner::SetRun(size_t run)
+{
+  // Run = point * replicates + replicate; the point picks one value per parameter, first parameter fastest.
+  size_t point = run / replicates;
+  for(const Param & param : grid)
+  {
+    config.Set(param.name, param.values[point % param.values.size()]);
+    point /= param.values.size();
+  }
+  config.SEED(config.SEED() + (int) (run % replicates));
+
+  // Every run writes its own files.
+  const std::string tag = "_" + std::to_string(run);
+  if(config.STATS_FILE() != "") { config.STATS_FILE(config.STATS_FILE() + tag); }
+  if(config.STATS_CSV() != "") { config.STATS_CSV(config.STATS_CSV() + tag); }
+  if(config.PHYLO_FILE() != "") { config.PHYLO_FILE(config.PHYLO_FILE() + tag); }
+  config.CHECKPOINT_FILE(config.CHECKPOINT_FILE() + tag);
+}
+
+void SweepRunner::Pin(size_t slot)
+{
+#ifdef __linux__
+  // Each slot gets THREAD_NUM cores of its own, wrapping around if there are more jobs than cores.
+  const size_t width = std::max<size_t>(1, config.THREAD_NUM());
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for(size_t i = 0; i < width; ++i) { CPU_SET(cores[(slot * width + i) % cores.size()], &set); }
+  if(sched_setaffinity(0, sizeof(set), &set) != 0) { std::cerr << "WARNING: Could not pin slot " << slot << std::endl; }
+#endif
+}
+
+void SweepRunner::RunChild(size_t run, size_t slot)
+{
+  Pin(slot);
+  SetRun(run);
+
+  // Keep the runs' progress lines apart.
+  if(!std::freopen(RunPath(run, ".log").c_str(), "w", stdout))
+  {
+    std::cerr << "ERROR: Could not open log for run " << run << std::endl;
+    exit(-1);
+  }
+
+  std::ostringstream summary;
+  summary << "run=" << run << "\n" << "replicate=" << run % replicates << "\n" << "SEED=" << config.SEED() << "\n";
+  for(const Param & param : grid) { summary << param.name << "=" << config.Get(param.name) << "\n"; }
+  RunWorld(config, std::cout, &summary);
+
+  // Only finished runs leave a summary behind.
+  std::ofstream file(RunPath(run, ".txt"));
+  file << summary.str();
+  file.close();
+  std::cout.flush();
+  exit(file.fail() ? -1 : 0);
+}
+
+bool SweepRunner::Run()
+{
+  const size_t num_runs = GetNumRuns();
+  const size_t num_jobs = std::min(GetNumJobs(), num_runs);
+  std::cout << "Sweep: " << GetNumPoints() << " points x " << replicates << " replicates on "
+            << num_jobs << " processes" << std::endl;
+
+  // A summary left over from an earlier sweep must not stand in for a run that dies in this one.
+  finished.assign(num_runs, false);
+  for(size_t run = 0; run < num_runs; ++run) { std::remove(RunPath(run, ".txt").c_str()); }
+
+  std::map<pid_t, std::pair<size_t, size_t>> running;   ///< Child pid -> (run, slot)
+  emp::vector<size_t> free_slots;
+  for(size_t s = num_jobs; s-- > 0; ) { free_slots.push_back(s); }
+
+  bool ok = true;
+  size_t next = 0;
+  while(next < num_runs || running.size())
+  {
+    // Start runs while there are free slots.
+    if(next < num_runs && free_slots.size())
+    {
+      const size_t slot = free_slots.back();
+      std::cout.flush();
+      std::cerr.flush();
+      const pid_t pid = fork();
+      if(pid < 0)
+      {
+        std::cerr << "ERROR: Could not start run " << next << std::endl;
+        exit(-1);
+      }
+      if(pid == 0) { RunChild(next, slot); }
+      free_slots.pop_back();
+      running[pid] = std::make_pair(next++, slot);
+      continue;
+    }
+
+    // Wait for one to finish.
+    int status = 0;
+    const pid_t pid = wait(&status);
+    if(pid < 0) { break; }
+    auto it = running.find(pid);
+    if(it == running.end()) { continue; }
+
+    const size_t run = it->second.first;
+    const bool good = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    std::cout << "Run " << run << (good ? " finished" : " FAILED") << std::endl;
+    ok = ok && good;
+    finished[run] = good;
+    free_slots.push_back(it->second.second);
+    running.erase(it);
+  }
+
+  std::ofstream csv(config.SWEEP_OUTPUT() + "_summary.csv");
+  Aggregate(csv);
+  return ok;
+}
+
+void SweepRunner::Aggregate(std::ostream & os) const
+{
+  // Every summary has the same keys in the same order, so the first one found names the columns.
+  bool header = false;
+  for(size_t run = 0; run < GetNumRuns(); ++run)
+  {
+    if(run >= finished.size() || !finished[run]) { std::cerr << "WARNING: Run " << run << " failed, left out of the summary" << std::endl; continue; }
+    std::ifstream is(RunPath(run, ".txt"));
+    if(!is.is_open()) { std::cerr << "WARNING: No summary for run " << run << std::endl; continue; }
+
+    emp::vector<std::string> keys, values;
+    for(std::string line; std::getline(is, line); )
+    {
+      const size_t eq = line.find('=');
+      if(eq == std::string::npos) { continue; }
+      keys.push_back(line.substr(0, eq));
+      values.push_back(line.substr(eq + 1));
+    }
+
+    if(!header)
+    {
+      for(size_t k = 0; k < keys.size(); ++k) { os << (k ? "," : "") << keys[k]; }
+      os << "\n";
+      header = true;
+    }
+    for(size_t v = 0; v < values.size(); ++v) { os << (v ? "," : "") << values[v]; }
+    os << "\n";
+  }
+}
+
+#endif